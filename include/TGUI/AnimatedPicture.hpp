@@ -291,7 +291,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
-        // When the elapsed time changes then this function is called.
+        // This function is called when the time has come to show the next frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
@@ -26,8 +26,9 @@
 #ifndef TGUI_CALLBACK_HPP
 #define TGUI_CALLBACK_HPP
 
-#include <map>
-#include <list>
+#include <deque>
+#include <vector>
+#include <atomic>
 #include <functional>
 
 #include <TGUI/Global.hpp>
@@ -74,6 +75,89 @@ namespace tgui
     };
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Queue in which the gui stores the callbacks until they are polled.
+    //
+    // The callbacks are kept in a preallocated ring buffer. When the thread safe mode is enabled, one thread may push callbacks
+    // while one other thread pops them, without any locking. Callbacks that don't fit in the ring buffer are kept aside by the
+    // pushing thread and are moved into the ring buffer as soon as the other side has made room for them.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CallbackQueue
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The capacity of the ring buffer is rounded up to a power of two.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CallbackQueue(std::size_t capacity = 256);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a callback to the back of the queue. Only the producing thread may call this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void push(const Callback& callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the oldest callback out of the queue. Returns false when there was no callback.
+        // Only the consuming thread may call this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool pop(Callback& callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves up to maxCount callbacks out of the queue and returns how many were written to the array.
+        // Only the consuming thread may call this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t pop(Callback* callbacks, std::size_t maxCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the callbacks that didn't fit in the ring buffer earlier into it, as far as there is room.
+        // Only the producing thread may call this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Change whether the queue is consumed from another thread. Only change this while no other thread uses the queue.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setThreadSafe(bool threadSafe);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the queue is consumed from another thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isThreadSafe() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the callback into the ring buffer. Returns false when the ring buffer is full.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool pushToRingBuffer(const Callback& callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The ring buffer. Its size is a power of two so that the indices only have to be masked.
+        std::vector<Callback> m_Buffer;
+        std::size_t           m_Mask;
+
+        // The indices keep increasing, the head is only written by the consumer and the tail only by the producer
+        std::atomic<std::size_t> m_Head;
+        std::atomic<std::size_t> m_Tail;
+
+        // Callbacks that didn't fit in the ring buffer, only accessed by the producer (or by anyone when not thread safe)
+        std::deque<Callback> m_Overflow;
+
+        bool m_ThreadSafe;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Used internally by all widgets to handle callbacks.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +165,13 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CallbackManager();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Bind a function to one or more specific callback trigger(s).
         ///
@@ -195,6 +286,30 @@ namespace tgui
         void unbindAllCallback();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Only deliver the latest callback of the given trigger(s) once per frame.
+        ///
+        /// \param trigger   The trigger(s) of which the callbacks should be coalesced
+        /// \param coalesce  Should the callbacks be coalesced?
+        ///
+        /// Some widgets send a lot of callbacks with the same trigger in a short time, e.g. a slider sends a ValueChanged
+        /// callback for every position that the thumb passes while it is being dragged. When the callbacks of a trigger are
+        /// coalesced, the widget holds them back and only the last one is sent when the gui is drawn. The callbacks that
+        /// were replaced never reach the bound functions or the callback queue.
+        ///
+        /// Coalesced callbacks are thus delivered later than the other callbacks of the widget.
+        /// When the widget is not part of a gui then the callbacks are sent immediately.
+        /// By default no callbacks are coalesced.
+        ///
+        /// Usage example:
+        /// \code
+        /// slider->setCallbackCoalescing(tgui::Slider::ValueChanged, true);
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCallbackCoalescing(unsigned int trigger, bool coalesce);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -204,10 +319,46 @@ namespace tgui
         void mapCallback(const std::function<void()>& function, unsigned int trigger);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when something is bound to at least one of the given trigger(s). This is only a mask test.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCallbackBound(unsigned int trigger) const
+        {
+            return (m_BoundTriggers & trigger) != 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when the trigger was bound to the parent and to nothing else (this is what gets stored in a widget file).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCallbackBoundToParentOnly(unsigned int trigger) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the functions bound to a single trigger. Only call this when isCallbackBound returned true for the trigger.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::function<void()>>& getCallbackFunctions(unsigned int trigger) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the lowest bit that is set in the trigger.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getTriggerIndex(unsigned int trigger);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::map<unsigned int, std::list<std::function<void()>>> m_CallbackFunctions;
+        // The functions bound to each trigger, indexed by the position of the trigger bit.
+        // The table only grows up to the highest trigger that was ever bound, most widgets never need more than a few entries.
+        std::vector<std::vector<std::function<void()>>> m_CallbackFunctions;
+
+        // One bit for every trigger that currently has at least one function bound to it
+        unsigned int m_BoundTriggers;
+
+        // The triggers of which only the last callback per frame is sent, and the callbacks that are waiting to be sent
+        unsigned int          m_CoalescedTriggers;
+        std::vector<Callback> m_CoalescedCallbacks;
 
         Callback m_Callback;
 
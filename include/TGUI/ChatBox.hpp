@@ -29,6 +29,8 @@
 
 #include <TGUI/Widget.hpp>
 
+#include <deque>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -141,6 +143,15 @@ namespace tgui
         virtual sf::Vector2f getFullSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the chat box covers when it is drawn, including the borders.
+        ///
+        /// \return Bounding box of the chat box
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Add a new line of text to the chat box.
         ///
@@ -200,6 +211,37 @@ namespace tgui
         void addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font = nullptr);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Add multiple lines of text to the chat box at once.
+        ///
+        /// The text is split at every newline character and each part is added as a separate line, as if \a addLine was called
+        /// for each of them. The chat box is only updated once, so this is a lot faster than adding a large block of text line
+        /// by line.
+        ///
+        /// The default text color and character size will be used.
+        ///
+        /// \param text  Text that will be added to the chat box
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Add multiple lines of text to the chat box at once.
+        ///
+        /// The text is split at every newline character and each part is added as a separate line, as if \a addLine was called
+        /// for each of them. The chat box is only updated once, so this is a lot faster than adding a large block of text line
+        /// by line.
+        ///
+        /// \param text      Text that will be added to the chat box
+        /// \param color     Color of the text
+        /// \param textSize  Size of the text
+        /// \param font      Font of the text (nullptr to use default font)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font = nullptr);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the contents of the requested line.
         ///
@@ -487,10 +529,52 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Information about a single line that was added to the chat box.
+        // The top of the line is stored relative to the first line that was ever added, so removing the front line does not
+        // require the other lines to be moved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Line
+        {
+            sf::String      text;
+            sf::Color       color;
+            unsigned int    textSize;
+            const sf::Font* font; // nullptr when the default font is used
+            unsigned int    linesOfText;
+            unsigned int    top;
+            unsigned int    height;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line to the back of the chat box without updating the scrollbar or the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts newlines in the text so that none of its lines is wider than maxWidth. Lines are preferably split between
+        // words. The text is only iterated once, accumulating the glyph advances and kerning from the text metrics.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::String wrapText(const sf::String& text, const sf::Font& font, unsigned int textSize, float maxWidth, unsigned int& linesOfText);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the maximum of the scrollbar and scrolls down to the last line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarAfterAddingLines();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Retrieve the space of one of the lines.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int getLineSpacing(unsigned int lineNumber);
+        unsigned int getLineSpacing(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the height and top of all lines, e.g. after the font or line spacing changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLineHeights();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -505,7 +589,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
-        // Update the position of the labels.
+        // Update the position of the lines that are visible inside the chat box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateDisplayedText();
 
@@ -546,7 +630,13 @@ namespace tgui
 
         bool m_LinesStartFromBottom;
 
-        // The panel containing the labels
+        // The lines in the chat box. New lines are appended at the back while the line limit removes lines from the front.
+        std::deque<Line> m_Lines;
+
+        // The texts of the lines that are currently visible in the chat box
+        std::vector<sf::Text> m_VisibleLines;
+
+        // The panel that draws the background and stores the default font
         Panel* m_Panel;
 
         // The scrollbar
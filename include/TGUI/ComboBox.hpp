@@ -139,6 +139,15 @@ namespace tgui
         virtual sf::Vector2f getFullSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the combo box covers when it is drawn, including the borders.
+        ///
+        /// \return Bounding box of the combo box
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the number of items that are displayed in the list.
         ///
@@ -28,6 +28,9 @@
 
 
 #include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
 
@@ -47,6 +50,31 @@ namespace tgui
         typedef SharedWidgetPtr<Container> Ptr;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief The name of a widget together with its hash.
+        ///
+        /// When the same widget is looked up very often, e.g. every frame, then you can create the key once and pass it to
+        /// the get function instead of the name, so that the name doesn't have to be hashed again on every call.
+        ///
+        /// Usage example:
+        /// \code
+        /// static const tgui::Container::NameKey hpLabelKey("hpLabel");
+        /// tgui::Label::Ptr hpLabel = gui.get<tgui::Label>(hpLabelKey, true);
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API NameKey
+        {
+            explicit NameKey(const sf::String& widgetName);
+
+            // Returns the hash of a widget name, it is the same hash that the containers use internally
+            static std::size_t hashName(const sf::String& widgetName);
+
+            sf::String  name;
+            std::size_t hash;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Default constructor
         ///
@@ -196,6 +224,41 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to an earlier created widget.
+        ///
+        /// \param widgetKey  The key that was created from the name that was given to the widget.
+        /// \param recursive  Should the function also search for widgets inside containers that are inside this container?
+        ///
+        /// \return Pointer to the earlier created widget
+        ///
+        /// \warning This function will return nullptr when an unknown widget name was passed.
+        ///
+        /// Unlike the function that takes a string, this function doesn't have to hash the name first.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr get(const NameKey& widgetKey, bool recursive = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to an earlier created widget.
+        ///
+        /// \param widgetKey  The key that was created from the name that was given to the widget.
+        /// \param recursive  Should the function also search for widgets inside containers that are inside this container?
+        ///
+        /// \return Pointer to the earlier created widget.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /// \warning This function will return nullptr when an unknown widget name was passed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr get(const NameKey& widgetKey, bool recursive = false) const
+        {
+            return typename T::Ptr(get(widgetKey, recursive));
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Makes a copy of any existing widget and returns the pointer to the new widget.
         ///
@@ -437,6 +500,67 @@ namespace tgui
         virtual sf::Vector2f getWidgetsOffset() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws the widgets inside the container on a texture which is reused until one of them changes.
+        ///
+        /// \param cacheRendering  Should the widgets be cached in a render texture?
+        ///
+        /// This is useful for panels and child windows with a lot of widgets that rarely change, as the container then only has
+        /// to draw a single sprite each frame. It costs an extra texture with the size of the container.
+        /// The cached texture is drawn with a shader, when shaders aren't supported the widgets are still drawn directly.
+        ///
+        /// Render caching is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCaching(bool cacheRendering);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the widgets inside the container are cached in a render texture.
+        ///
+        /// \return Is render caching enabled?
+        ///
+        /// \see setRenderCaching
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getRenderCaching() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Keeps track of which widgets lie where, so that the widget below the mouse can be found faster.
+        ///
+        /// \param useSpatialIndex  Should the spatial index be used?
+        /// \param cellSize         The size of the cells in which the area of the container is divided
+        ///
+        /// Without the index, every mouse event has to ask every widget in the container whether the mouse is on top of it.
+        /// With the index, only the widgets whose bounds overlap the cell below the mouse are checked.
+        /// This is useful for containers with a lot of widgets, e.g. a panel with a grid of hundreds of pictures.
+        /// The cell size should be in the order of the size of the widgets inside the container.
+        ///
+        /// The spatial index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexing(bool useSpatialIndex, float cellSize = 64);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether a spatial index is used to find the widget below the mouse.
+        ///
+        /// \return Is the spatial index used?
+        ///
+        /// \see setSpatialIndexing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSpatialIndexing() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /// Besides telling the parent, this will also make sure that the render cache is drawn again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is used internally by child widget to alert there parent about a callback.
@@ -506,9 +630,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called every frame.
+        // Besides the container itself, also the widgets inside it have moved on the screen.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void update();
+        virtual void absolutePositionChanged();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,16 +660,108 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
+        // When the mouse is no longer on the widget that it was on before then that widget is informed about it.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr mouseOnWhichWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the widget that the mouse was on top of that the mouse left it. Unlike looping over all widgets, this only
+        // affects the widgets along the path to the widget below the mouse.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unhoverWidgets();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the render cache when they changed and then draws the cache on the target.
+        // Returns false when the render texture couldn't be created, in which case nothing was drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawRenderCache(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called by the child widgets when they changed, their bounds may have to be updated in the spatial index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Brings the spatial index up to date with the widgets. The index is only rebuilt completely when widgets were
+        // removed or reordered, otherwise only the widgets that were added or changed are updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the widget with the given index to or from all cells that it covers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToSpatialIndex(unsigned int index);
+        void removeFromSpatialIndex(unsigned int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up a widget by its name and the hash of that name. When searching recursively, the widgets that are found
+        // are remembered so that the next lookup of the same name doesn't have to search in the child containers again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getWidgetByName(const sf::String& widgetName, std::size_t hash, bool recursive) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the widget with the given name in the name index, and in the child containers when searching recursively.
+        // Like in older versions, when multiple widgets have the same name then the one that comes first in a depth-first
+        // search is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetByName(const sf::String& widgetName, std::size_t hash, bool recursive) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when widgets were added, removed, reordered or renamed. The name index will be rebuilt on
+        // the next lookup and the widgets found by recursive lookups in this container and its parents are forgotten.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetNamesChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the name index when it is no longer up to date.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The widgets call this function when they want their update function to be called. The request is passed on to
+        // the parent until it reaches the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void scheduleChildUpdate(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The widgets call this function when they are holding back coalesced callbacks. The request is passed on to the
+        // parent until it reaches the gui. When the widget is not part of a gui then the callbacks are sent immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void scheduleChildCallbacks(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Schedules the updates that the widget and the widgets inside it requested, when they were requested before the
+        // widget was added to the container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void registerScheduledUpdates(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the updates that the widget and the widgets inside it scheduled from the gui, because the widget is being
+        // removed from it. The widgets remember that they want to be updated, in case they are added to a gui again.
+        // The coalesced callbacks that the widgets were still holding back are dropped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unregisterScheduledUpdates(Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -555,11 +771,44 @@ namespace tgui
         // The id of the focused widget
         unsigned int m_FocusedWidget;
 
+        // The widget that the mouse was on top of the last time it was checked
+        Widget::Ptr m_HoveredWidget;
+
+        // The widget that can be dragged and on which the left mouse button went down. It receives all mouse move events
+        // until the mouse is released, so the other widgets don't have to be checked.
+        Widget::Ptr m_CapturedWidget;
+
         sf::Font m_GlobalFont;
 
         // A list that stores all functions that receive callbacks triggered by child widgets
         std::list< std::function<void(const Callback&)> > m_GlobalCallbackFunctions;
 
+        // The texture on which the widgets are drawn when render caching is enabled. It is only created when needed.
+        bool                       m_RenderCaching;
+        mutable bool               m_RenderCacheNeedsUpdate;
+        mutable sf::RenderTexture* m_RenderCache;
+
+        // A uniform grid that stores for each cell the sorted indices of the widgets that overlap with it.
+        // For every widget, the range of cells that it covers is kept as well, so that it can be moved to other cells.
+        bool                                                      m_SpatialIndexing;
+        float                                                     m_SpatialIndexCellSize;
+        bool                                                      m_SpatialIndexNeedsRebuild;
+        std::map<std::pair<int, int>, std::vector<unsigned int> > m_SpatialIndexCells;
+        std::vector<sf::IntRect>                                  m_SpatialIndexWidgetCells;
+        std::map<const Widget*, unsigned int>                     m_SpatialIndexWidgetIds;
+        std::set<const Widget*>                                   m_SpatialIndexChangedWidgets;
+
+        // Maps the hash of every widget name to the indices of the widgets with that name, in the order of m_Widgets.
+        // The indices of the child containers are kept as well, for recursive lookups.
+        // Widgets found by recursive lookups are cached until the names change somewhere below this container.
+        mutable bool                                                                               m_NameIndexNeedsRebuild;
+        mutable std::unordered_map<std::size_t, std::vector<unsigned int> >                        m_NameIndex;
+        mutable std::vector<unsigned int>                                                          m_NameIndexContainers;
+        mutable std::unordered_map<std::size_t, std::vector<std::pair<sf::String, Widget::Ptr> > > m_RecursiveNameCache;
+
+
+        friend class Widget;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -575,6 +824,20 @@ namespace tgui
         typedef SharedWidgetPtr<Container> Ptr;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Unbind the global callback function(s).
         ///
@@ -617,6 +880,13 @@ namespace tgui
         virtual bool mouseOnWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /// Remembers that the gui has to be drawn again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -627,12 +897,81 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the widget in the timer wheel, at the time that it asked for.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void scheduleChildUpdate(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the scheduled update of the widget from the timer wheel.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unscheduleUpdate(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Advances the clock of the timer wheel and calls the update function of the widgets whose time has come.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTime(const sf::Time& elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the earliest time on the clock of the timer wheel at which a widget has to be updated.
+        // Returns false when no widget is waiting to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getNextUpdateTime(sf::Time& updateTime) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the widget is holding back coalesced callbacks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void scheduleChildCallbacks(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets about the coalesced callbacks of the widget, they will no longer be sent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unscheduleCallbacks(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets all widgets send the callbacks that they were holding back. This is done once per frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sendCoalescedCallbacks();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         sf::RenderTarget* m_Window;
 
+        // Did one of the widgets change since the last time that the gui was drawn?
+        bool m_RedrawNeeded;
+
+        // The widgets that want to be updated are stored in a timer wheel. Every slot contains the widgets that have to be
+        // updated within a short period of time. Widgets that have to wait longer than a full turn of the wheel stay in
+        // their slot until the wheel comes by at the right time. Widgets whose time has come are moved to m_DueWidgets
+        // before their update function is called, as those functions may schedule or remove other widgets.
+        sf::Time                            m_Time;
+        sf::Time                            m_TimerWheelSlotDuration;
+        std::vector< std::vector<Widget*> > m_TimerWheel;
+        std::vector<Widget*>                m_DueWidgets;
+
+        // The earliest time at which a widget in the timer wheel has to be updated. It is kept up to date while widgets are
+        // scheduled. Only when the widget with the earliest time leaves the wheel, the wheel is searched again the next time
+        // that the time is asked for.
+        mutable bool                        m_NextUpdateTimeNeedsUpdate;
+        mutable bool                        m_NextUpdateTimeFound;
+        mutable sf::Time                    m_NextUpdateTime;
+
+        // The widgets that are holding back coalesced callbacks. Widgets that are removed are replaced by a nullptr.
+        std::vector<Widget*> m_CoalescedCallbackWidgets;
+
 
+        friend class Container;
         friend class Gui;
 
 
@@ -454,6 +454,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void textEntered(sf::Uint32 Key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,6 +492,12 @@ namespace tgui
       protected:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the first characters of the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTextWidth(unsigned int length) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will search where the selection point should be. It will not change the selection point.
         // It will return after which character the selection point should be.
@@ -514,7 +525,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // When AnimationManager changes the elapsed time then this function is called.
+        // This function is called every half second while the edit box is focused, to make the selection point blink.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
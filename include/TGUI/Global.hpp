@@ -37,6 +37,8 @@
 #include <TGUI/Borders.hpp>
 
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Renderer.hpp>
+#include <TGUI/TextMetrics.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -126,6 +128,25 @@ namespace tgui
     TGUI_API void disableTabKeyUsage();
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Packs the images of the widgets that are loaded from now on into a few large textures.
+    ///
+    /// \param pageSize  Width and height of the textures in which the images are packed.
+    ///
+    /// Widgets that share a texture can be drawn together, which greatly reduces the amount of draw calls.
+    /// Call this function before loading any widgets, images that were already loaded keep their own texture.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void enableTextureAtlas(unsigned int pageSize = 1024);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Images that are loaded from now on will each get their own texture again (default).
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void disableTextureAtlas();
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Set a new resource path.
     ///
@@ -155,6 +176,12 @@ namespace tgui
     /// \internal The texture manager will not just load the textures, but will also make sure that the textures are only loaded once.
     extern TGUI_API TextureManager TGUI_TextureManager;
 
+    /// \internal The renderer batches the sprites and rectangles that the widgets draw while the gui is being drawn.
+    extern TGUI_API Renderer TGUI_Renderer;
+
+    /// \internal The text metrics cache the advances and kerning of the fonts, so that widgets can measure their text quickly.
+    extern TGUI_API TextMetrics TGUI_TextMetrics;
+
     /// \internal The internal clipboard that widgets use
     class Clipboard;
     extern TGUI_API Clipboard TGUI_Clipboard;
@@ -27,7 +27,8 @@
 #define TGUI_WINDOW_HPP
 
 
-#include <queue>
+#include <atomic>
+#include <deque>
 
 #include <TGUI/Container.hpp>
 
@@ -35,6 +36,66 @@
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Queue in which other threads can place functions that have to be executed on the thread that uses the gui.
+    //
+    // Any thread may push functions without locking: they are added to a linked list with an atomic operation.
+    // The thread that uses the gui takes the whole list at once and executes the functions in the order in which they were
+    // pushed. Functions that didn't get executed because of the limit are kept until the next time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destructor. The functions that were not executed yet are destroyed without being called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a function to the queue. This function may be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void push(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes at most maxCommands functions from the queue and returns how many functions were executed.
+        // Only the thread that uses the gui may call this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int execute(unsigned int maxCommands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when there are no functions waiting to be executed.
+        // Only the thread that uses the gui may call this function, the answer can change at any time when other threads push.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        struct Node
+        {
+            std::function<void()> command;
+            Node* next;
+        };
+
+        // The functions that were pushed since the last time that the queue was executed, the newest one comes first
+        std::atomic<Node*> m_Head;
+
+        // The functions that were taken from the list but have not been executed yet, the oldest one comes first
+        std::deque< std::function<void()> > m_Pending;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Gui : public sf::NonCopyable
@@ -131,6 +192,130 @@ namespace tgui
         void draw(bool resetView = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of draw calls that the last call to the draw function made on the window.
+        ///
+        /// The sprites and rectangles of the widgets are batched together while drawing, so this number is usually
+        /// much lower than the amount of widgets.
+        ///
+        /// \return Number of draw calls made by the last frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Finds out whether something changed since the last time that the gui was drawn.
+        ///
+        /// \return True when one of the widgets changed and the gui has to be drawn again
+        ///
+        /// When this function returns false and nothing else on your screen changed, then you don't have to draw and display
+        /// the window at all. Call updateTime first, so that e.g. a blinking edit box cursor gets the chance to request
+        /// a redraw and the functions that other threads posted are applied.
+        ///
+        /// Usage example:
+        /// \code
+        /// gui.updateTime();
+        /// if (gui.isRedrawNeeded())
+        /// {
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRedrawNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Advances the time of the animated widgets and applies the changes that other threads posted.
+        ///
+        /// This function is called automatically by the draw function. You only need to call it yourself when you want to
+        /// know whether the gui has to be drawn before drawing it.
+        ///
+        /// \see isRedrawNeeded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Finds out how long it takes before one of the widgets will change by itself.
+        ///
+        /// \param timeUntilUpdate  Time until the next blink of a selection point, frame of an animated picture, ...
+        ///
+        /// \return False when none of the widgets is waiting to be updated, in which case the gui only changes on events
+        ///
+        /// When the gui already has to be drawn again then the time will be zero. This allows you to only wake up when
+        /// there is an event or when the gui will change, instead of drawing the gui every frame.
+        ///
+        /// Usage example:
+        /// \code
+        /// sf::Time timeout;
+        /// if (gui.getTimeUntilNextUpdate(timeout))
+        /// {
+        ///     // Handle the events that arrive in the meantime and draw the gui again when the time has passed
+        /// }
+        /// else // Nothing will happen until the next event
+        ///     window.waitEvent(event);
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTimeUntilNextUpdate(sf::Time& timeUntilUpdate) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Keeps a copy of the last drawn gui, which is reused while none of the widgets change.
+        ///
+        /// \param cacheFrames  Should the gui be cached in a render texture?
+        ///
+        /// When frame caching is enabled, the draw function only has to copy a single texture to the window as long as
+        /// none of the widgets changed. This costs an extra texture with the size of the window.
+        /// Frame caching requires shaders, it is turned off when they aren't supported.
+        ///
+        /// Frame caching is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFrameCaching(bool cacheFrames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the gui is cached in a render texture.
+        ///
+        /// \return Is frame caching enabled?
+        ///
+        /// \see setFrameCaching
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getFrameCaching() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Keeps track of which widgets lie where, so that the widget below the mouse can be found faster.
+        ///
+        /// \param useSpatialIndex  Should the spatial index be used?
+        /// \param cellSize         The size of the cells in which the window is divided
+        ///
+        /// This is useful when a lot of widgets are added directly to the gui. See Container::setSpatialIndexing for more information.
+        ///
+        /// The spatial index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexing(bool useSpatialIndex, float cellSize = 64);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether a spatial index is used to find the widget below the mouse.
+        ///
+        /// \return Is the spatial index used?
+        ///
+        /// \see setSpatialIndexing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSpatialIndexing() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the next callback from the callback queue.
         ///
@@ -152,6 +337,127 @@ namespace tgui
         bool pollCallback(Callback& callback);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get multiple callbacks from the callback queue at once.
+        ///
+        /// The callbacks are moved out of the queue in the order in which they occurred, just like when calling pollCallback
+        /// repeatedly. The contents of the array elements that are overwritten will be reused by the queue.
+        ///
+        /// \param callbacks  Array in which the callbacks will be stored
+        /// \param maxCount   The maximum amount of callbacks that can be stored in the array
+        ///
+        /// \return The amount of callbacks that were stored in the array.
+        ///
+        /// \see pollCallback
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t drainCallbacks(Callback* callbacks, std::size_t maxCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allow the callbacks to be polled from another thread.
+        ///
+        /// \param threadSafe  Will pollCallback and drainCallbacks be called from another thread?
+        ///
+        /// When enabled, one other thread may call pollCallback and drainCallbacks while the gui is used on the main thread.
+        /// Neither of the threads will ever have to wait for the other one. Only a single thread may poll the callbacks.
+        ///
+        /// Callbacks that occur while the queue is full are kept aside by the main thread. They are added to the queue when
+        /// the next callback occurs or when the gui is drawn.
+        ///
+        /// This function may only be called while no other thread is polling the callbacks.
+        /// Thread safe polling is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCallbackQueueThreadSafe(bool threadSafe);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the callbacks may be polled from another thread.
+        ///
+        /// \return Is thread safe polling enabled?
+        ///
+        /// \see setCallbackQueueThreadSafe
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getCallbackQueueThreadSafe() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Executes a function on the thread that uses the gui.
+        ///
+        /// \param command  The function that is to be executed
+        ///
+        /// The gui is not thread safe, but this function may be called from any thread.
+        /// The functions are executed in the order in which they were posted, at the start of handleEvent and draw.
+        ///
+        /// Usage example:
+        /// \code
+        /// gui.post([=]() { loadingBar->setValue(progress); });
+        /// \endcode
+        ///
+        /// \see setMaxCommandsPerFrame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Executes a function on a widget, on the thread that uses the gui.
+        ///
+        /// \param widgetName  The name that was given to the widget when it was added to the gui (or to a container inside it)
+        /// \param command     The function that is to be executed on the widget
+        ///
+        /// This function may be called from any thread. The widget is only looked up when the function is executed,
+        /// so the thread that posts it never touches the widget. When no widget with the given name exists by then,
+        /// the function is not called.
+        ///
+        /// Usage example:
+        /// \code
+        /// gui.post<tgui::ChatBox>("ChatBox", [=](tgui::ChatBox& chatBox) { chatBox.addLine(message); });
+        /// \endcode
+        ///
+        /// \see post(std::function<void()>)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        void post(const sf::String& widgetName, std::function<void(T&)> command)
+        {
+            const Container::NameKey widgetKey(widgetName);
+            GuiContainer* container = &m_Container;
+            m_Commands.push([=]()
+                {
+                    typename T::Ptr widget = container->get<T>(widgetKey, true);
+                    if (widget.get() != nullptr)
+                        command(*widget);
+                });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Limit the amount of posted functions that are executed during a single frame.
+        ///
+        /// \param maxCommands  The maximum amount of posted functions that are executed between two calls to draw.
+        ///                     Pass 0 to execute all posted functions without a limit.
+        ///
+        /// When other threads post more functions than this, the remaining functions are executed during the next frames.
+        /// By default there is no limit.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaxCommandsPerFrame(unsigned int maxCommands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the maximum amount of posted functions that are executed during a single frame.
+        ///
+        /// \return The maximum amount of functions, or 0 when there is no limit
+        ///
+        /// \see setMaxCommandsPerFrame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getMaxCommandsPerFrame() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Check if the window is focused.
         ///
@@ -303,6 +609,48 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to an earlier created widget.
+        ///
+        /// \param widgetKey  The key that was created from the name that was given to the widget.
+        /// \param recursive  Should the function also search for widgets inside containers that are inside this container?
+        ///
+        /// \return Pointer to the earlier created widget
+        ///
+        /// \warning This function will return nullptr when an unknown widget name was passed.
+        ///
+        /// Unlike the function that takes a string, this function doesn't have to hash the name first.
+        /// Widgets that are found in a recursive search are remembered until a widget is added, removed or renamed.
+        ///
+        /// Usage example:
+        /// \code
+        /// static const tgui::Container::NameKey hpLabelKey("hpLabel");
+        /// tgui::Label::Ptr hpLabel = gui.get<tgui::Label>(hpLabelKey, true);
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr get(const Container::NameKey& widgetKey, bool recursive = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to an earlier created widget.
+        ///
+        /// \param widgetKey  The key that was created from the name that was given to the widget.
+        /// \param recursive  Should the function also search for widgets inside containers that are inside this container?
+        ///
+        /// \return Pointer to the earlier created widget.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /// \warning This function will return nullptr when an unknown widget name was passed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr get(const Container::NameKey& widgetKey, bool recursive = false) const
+        {
+            return m_Container.get<T>(widgetKey, recursive);
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Makes a copy of any existing widget and returns the pointer to the new widget.
         ///
@@ -523,8 +871,23 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        // This will store all widget callbacks until you pop them with getCallback
-        std::queue<Callback> m_Callback;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the given target, with clipping enabled for the whole target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the functions that were posted by other threads, as far as the limit of this frame allows it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void executeCommands();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // This will store all widget callbacks until you pop them with pollCallback or drainCallbacks
+        CallbackQueue m_Callback;
 
         // The internal clock which is used for animation of widgets
         sf::Clock m_Clock;
@@ -535,9 +898,22 @@ namespace tgui
         // Does m_Window contains a sf::RenderWindow?
         bool m_accessToWindow;
 
+        // The amount of draw calls made during the last frame
+        unsigned int m_DrawCallCount;
+
+        // The texture in which the gui is cached when frame caching is enabled, and the view that was used to draw it
+        sf::RenderTexture m_FrameCache;
+        sf::View          m_FrameCacheView;
+        bool              m_FrameCaching;
+
         // Internal container to store all widgets
         GuiContainer m_Container;
 
+        // The functions that other threads posted, and how many of them may still be executed during this frame
+        CommandQueue m_Commands;
+        unsigned int m_MaxCommandsPerFrame;
+        unsigned int m_CommandsExecuted;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -138,6 +138,15 @@ namespace tgui
         virtual sf::Vector2f getFullSize() const;
 
 
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the list box covers when it is drawn, including the borders.
+        ///
+        /// \return Bounding box of the list box
+        ///
+        //////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the colors used in the list box.
         ///
@@ -101,6 +101,17 @@ namespace tgui
         virtual sf::Vector2f getSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the menu bar covers when it is drawn.
+        ///
+        /// When a menu is open, the area below the menu bar that is used by the menu is also included.
+        ///
+        /// \return Bounding box of the menu bar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Adds a new menu.
         ///
@@ -0,0 +1,303 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDERER_HPP
+#define TGUI_RENDERER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    struct Texture;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    /// \brief Collects the sprites and rectangles drawn by the widgets into vertex arrays.
+    ///
+    /// Between beginFrame and endFrame, everything that the widgets draw on the target passes through this class.
+    /// Consecutive sprites that use the same texture and consecutive untextured rectangles are merged into a single quad
+    /// array, which is only drawn when the texture changes, when something that can't be batched (e.g. a text) has to be
+    /// drawn or when the clipping area is about to change. The result looks exactly the same as drawing everything directly.
+    ///
+    /// When no frame was started for the target, every call is simply forwarded to the target.
+    ///
+    /// The renderer also keeps the clipping areas of the widgets on a stack. The scissor box is only queried once per frame
+    /// and glScissor is only called when the effective clipping area really changes. Widgets that are drawn outside a frame
+    /// still get clipped, but then the scissor box is queried and changed on every push and pop.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Renderer : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Renderer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Starts batching everything that is drawn on the target.
+        ///
+        /// \param target  The target on which the widgets are going to be drawn
+        ///
+        /// The draw call counter is reset when calling this function.
+        /// The whole target (or the scissor box when clipping was already enabled) becomes the clipping area.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginFrame(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws whatever is still waiting in the batch and stops batching.
+        ///
+        /// The clipping is restored to the state it was in when beginFrame was called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Temporarily batches everything that is drawn on another target, without ending the frame.
+        ///
+        /// \param target  The target on which the widgets are going to be drawn until popTarget is called
+        ///
+        /// Containers use this to draw their widgets on their render cache while the gui is being drawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushTarget(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Finishes drawing on the target that was passed to pushTarget and continues with the previous target.
+        ///
+        /// The OpenGL context of the previous target is activated again, so that the clipping of the widgets keeps working.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void popTarget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Only allows drawing inside the given area until popClipping is called.
+        ///
+        /// \param target  The target that is being drawn on
+        /// \param rect    The area in which drawing is allowed, in the coordinates of the current view of the target
+        ///
+        /// The area is intersected with the clipping area that was already active.
+        /// Outside a frame the scissor box is changed directly, so it only has an effect when the scissor test is enabled.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushClipping(sf::RenderTarget& target, const sf::FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Restores the clipping area that was active before the last call to pushClipping.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void popClipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Checks whether something drawn in the given area could still be visible.
+        ///
+        /// \param target  The target that is being drawn on
+        /// \param rect    The area to check, in the coordinates of the current view of the target
+        ///
+        /// \return False when the area lies completely outside the active clipping area, true otherwise
+        ///
+        /// When no frame is being drawn on the target, this function always returns true.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isVisible(sf::RenderTarget& target, const sf::FloatRect& rect) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a texture that was loaded by the texture manager.
+        ///
+        /// \param target   The target to draw on
+        /// \param texture  The texture to draw
+        /// \param states   The render states to use
+        ///
+        /// A repeated texture that is stored in an atlas page is drawn as one quad for every time the image is repeated.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const Texture& texture, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a sprite.
+        ///
+        /// \param target  The target to draw on
+        /// \param sprite  The sprite to draw
+        /// \param states  The render states to use
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a rectangle.
+        ///
+        /// \param target     The target to draw on
+        /// \param rectangle  The rectangle to draw
+        /// \param states     The render states to use
+        ///
+        /// Only rectangles without outline and without texture are batched, other rectangles are drawn directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const sf::RectangleShape& rectangle, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws any other drawable object.
+        ///
+        /// \param target    The target to draw on
+        /// \param drawable  The object to draw
+        /// \param states    The render states to use
+        ///
+        /// The batch is flushed first, so that the object ends up on top of everything that was drawn before it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws the waiting quads on the target.
+        ///
+        /// This has to be called before changing anything that influences drawing outside of the render states,
+        /// like the clipping area.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of draw calls that were made on the target since the frame was started.
+        ///
+        /// \return Number of draw calls
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws the texture of a render texture that was cleared with a transparent color before drawing on it.
+        ///
+        /// \param target  The target to draw on
+        /// \param sprite  The sprite that shows the texture of the render texture
+        /// \param states  The render states to use
+        ///
+        /// \return False when shaders aren't supported, nothing is drawn in that case
+        ///
+        /// The colors in such a texture were already multiplied with their alpha value when they were drawn on it. Drawing
+        /// the texture with alpha blending would multiply them a second time, which makes translucent pixels too dark.
+        /// A shader divides the colors by their alpha value first, so that the result looks the same as drawing directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawRenderTexture(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when the draw calls on this target are currently being batched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatching(const sf::RenderTarget& target) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a quad to the batch. The texture coordinates are ignored when no texture is passed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addQuad(const sf::Transform& transform, const sf::FloatRect& rect, const sf::FloatRect& texCoords,
+                     const sf::Color& color, const sf::Texture* texture, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the clipping area on top of the stack to glScissor, unless it is already the active scissor box.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyClipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Activates the OpenGL context of the target, so that the gl calls end up on the correct target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void activate(sf::RenderTarget* target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The target that is being drawn on between beginFrame and endFrame, or nullptr when not batching
+        sf::RenderTarget* m_Target;
+
+        // The targets that were replaced by pushTarget, together with their clipping state
+        struct PreviousTarget
+        {
+            sf::RenderTarget* target;
+            sf::IntRect       appliedClipping;
+            unsigned int      clippingStackSize;
+        };
+        std::vector<PreviousTarget> m_PreviousTargets;
+
+        // The clipping areas in pixels (with the origin in the top left corner), the last one is the active one
+        std::vector<sf::IntRect> m_ClippingStack;
+        sf::IntRect       m_AppliedClipping;
+
+        // The scissor boxes (in OpenGL coordinates) that were replaced by pushClipping outside a frame,
+        // together with the size of the clipping stack right after the push
+        struct DirectClipping
+        {
+            sf::IntRect       oldScissorBox;
+            unsigned int      clippingStackSize;
+        };
+        std::vector<DirectClipping> m_DirectClipping;
+
+        // The scissor state from before the frame, to restore it in endFrame
+        bool              m_ClippingWasEnabled;
+        sf::IntRect       m_OldScissorBox;
+
+        // The quads that are waiting to be drawn, they all share the same texture and blend mode
+        sf::VertexArray   m_Vertices;
+        const sf::Texture* m_Texture;
+        sf::BlendMode     m_BlendMode;
+
+        // The amount of draw calls made since the frame was started
+        unsigned int      m_DrawCalls;
+
+        // The shader used by drawRenderTexture, it is only loaded when it is used for the first time
+        sf::Shader        m_UnpremultiplyShader;
+        bool              m_UnpremultiplyShaderLoaded;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDERER_HPP
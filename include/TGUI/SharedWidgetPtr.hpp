@@ -187,7 +187,15 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Deprecated, use getUseCount instead. The returned pointer points inside the widget and is only valid while it exists.
+        // It isn't available when the reference count is atomic.
+#ifndef TGUI_THREAD_SAFE_REFCOUNT
         unsigned int* getRefCount() const;
+#endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int getUseCount() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -196,8 +204,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
+        // The reference count is stored inside the widget itself
         T* m_WidgetPtr;
-        unsigned int* m_RefCount;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
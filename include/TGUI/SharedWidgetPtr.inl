@@ -48,8 +48,7 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(std::nullptr_t) :
-    m_WidgetPtr(nullptr),
-    m_RefCount (nullptr)
+    m_WidgetPtr(nullptr)
     {
     }
 
@@ -76,40 +75,22 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy) :
+    m_WidgetPtr(copy.get())
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = copy.get();
-
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        if (m_WidgetPtr != nullptr)
+            ++m_WidgetPtr->m_RefCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
     template <class U>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy) :
+    m_WidgetPtr(static_cast<T*>(copy.get()))
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
-
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        if (m_WidgetPtr != nullptr)
+            ++m_WidgetPtr->m_RefCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,20 +108,13 @@ namespace tgui
     {
         if (this != &copy)
         {
-            reset();
+            // The new reference is added first, in case both pointers point to the same widget
+            T* widget = copy.get();
+            if (widget != nullptr)
+                ++widget->m_RefCount;
 
-            if (copy.get() != nullptr)
-            {
-                m_WidgetPtr = copy.get();
-
-                m_RefCount = copy.getRefCount();
-                *m_RefCount += 1;
-            }
-            else
-            {
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
+            reset();
+            m_WidgetPtr = widget;
         }
 
         return *this;
@@ -152,20 +126,13 @@ namespace tgui
     template <class U>
     SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(const SharedWidgetPtr<U>& copy)
     {
-        reset();
-
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        // The new reference is added first, in case both pointers point to the same widget
+        T* widget = static_cast<T*>(copy.get());
+        if (widget != nullptr)
+            ++widget->m_RefCount;
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        reset();
+        m_WidgetPtr = widget;
 
         return *this;
     }
@@ -177,10 +144,8 @@ namespace tgui
     {
         reset();
 
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
-
         m_WidgetPtr = new T();
+        m_WidgetPtr->m_RefCount = 1;
         m_WidgetPtr->m_Callback.widget = get();
     }
 
@@ -191,16 +156,11 @@ namespace tgui
     {
         if (m_WidgetPtr != nullptr)
         {
-            if (*m_RefCount == 1)
-            {
+            // Only the pointer that removes the last reference may destroy the widget
+            if (--m_WidgetPtr->m_RefCount == 0)
                 delete m_WidgetPtr;
-                delete m_RefCount;
 
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
-            else
-                *m_RefCount -= 1;
+            m_WidgetPtr = nullptr;
         }
     }
 
@@ -274,10 +234,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#ifndef TGUI_THREAD_SAFE_REFCOUNT
     template <class T>
     unsigned int* SharedWidgetPtr<T>::getRefCount() const
     {
-        return m_RefCount;
+        if (m_WidgetPtr != nullptr)
+            return &m_WidgetPtr->m_RefCount;
+        else
+            return nullptr;
+    }
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    unsigned int SharedWidgetPtr<T>::getUseCount() const
+    {
+        if (m_WidgetPtr != nullptr)
+            return m_WidgetPtr->m_RefCount;
+        else
+            return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,10 +265,8 @@ namespace tgui
         {
             SharedWidgetPtr<T> pointer = nullptr;
 
-            pointer.m_RefCount = new unsigned int;
-            *pointer.m_RefCount = 1;
-
             pointer.m_WidgetPtr = m_WidgetPtr->clone();
+            pointer.m_WidgetPtr->m_RefCount = 1;
             pointer.m_WidgetPtr->m_Callback.widget = pointer.get();
             return pointer;
         }
@@ -140,6 +140,17 @@ namespace tgui
         virtual sf::Vector2f getSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the slider covers when it is drawn.
+        ///
+        /// The thumb can stick out of the track, so the returned area is a bit larger than the size of the slider.
+        ///
+        /// \return Bounding box of the slider
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Sets a minimum value.
         ///
@@ -28,6 +28,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/WidgetArena.hpp>
 #include <TGUI/ClickableWidget.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Label.hpp>
@@ -426,6 +426,12 @@ namespace tgui
         virtual void initialize(Container *const container);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the name of a tab, measured with the current font and text size without changing m_Text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getNameWidth(const sf::String& name) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/TextBuffer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -140,6 +141,15 @@ namespace tgui
         virtual sf::Vector2f getFullSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the text box covers when it is drawn, including the borders.
+        ///
+        /// \return Bounding box of the text box
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the text of the text box.
         ///
@@ -158,6 +168,34 @@ namespace tgui
         void addText(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Replaces the text of the text box with the contents of a UTF-8 encoded file.
+        ///
+        /// The file is read and decoded in small blocks, so no second copy of the whole file is ever kept in memory.
+        /// Only the lines that are visible are wrapped immediately, the rest of the text is wrapped a part at a time during
+        /// the next updates of the gui. The scrollbar grows while this happens.
+        ///
+        /// \param filename  Filename of the text file
+        ///
+        /// \return True when the file was loaded, false when it could not be opened
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadTextFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Replaces the text of the text box with UTF-8 encoded data from memory.
+        ///
+        /// The data is decoded directly into the text box without being copied first. Like with loadTextFromFile, only the
+        /// visible lines are wrapped immediately and the rest of the text is wrapped during the next updates of the gui.
+        ///
+        /// \param data         Pointer to the UTF-8 data, which is no longer needed when this function returns
+        /// \param sizeInBytes  Size of the data in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadTextFromMemory(const void* data, std::size_t sizeInBytes);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the text of the text box.
         ///
@@ -495,6 +533,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseNoLongerDown();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetFocused();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,6 +585,12 @@ namespace tgui
         void selectText(float posX, float posY);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the scrollbar when the line with the selection point isn't (completely) inside the text box.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollToSelectionPoint();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -549,6 +598,103 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that a character adds to a line, including the kerning with the character in front of it.
+        // Pass 0 as prevChar when the character is the first one on the line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getCharacterWidth(sf::Uint32 prevChar, sf::Uint32 curChar) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of a part of the text. The part should not contain a newline character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTextWidth(std::size_t start, std::size_t end) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available for the lines of text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the line on which the selection point is drawn when it is placed in front of the given character.
+        // When the text was wrapped in front of the character then the selection point stays at the end of the previous line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findLineOfCharacter(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the selection point when it is placed in front of the given character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f findCharacterPosition(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index behind the last character on a line, not counting the newline character that ends the line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineEnd(unsigned int line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the character on a line in front of which the selection point is placed when clicking at posX.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findCharacterOnLine(unsigned int line, float posX) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts or removes characters and updates the lines that are affected by the change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertText(std::size_t position, const sf::String& text);
+        void eraseText(std::size_t position, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes UTF-8 characters and adds them behind the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendUtf8Text(const char* begin, const char* end);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a text was loaded. Places the selection point at the start and wraps the visible lines of the new text,
+        // the rest of the lines are wrapped by the update function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishLoadingText();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index where the line behind the one starting at lineStart begins. When there is no next line then the
+        // size of the text is returned and the character in front of it is not a newline.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findNextLineStart(std::size_t lineStart, float maxLineWidth) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wraps the whole text again. This is needed when the width of the text box or the font changes.
+        // While a loaded text is still being wrapped, only the lines that are needed right now are wrapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLineStarts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wraps the text again after some characters were removed and/or inserted at the given position. Only the lines from
+        // the line in front of the change are wrapped again, until a line starts at the same character as it did before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLineStarts(std::size_t position, std::size_t removedChars, std::size_t insertedChars);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wraps the text behind the last known line start, until a line ends more than maxCharacters behind that line start.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapLines(std::size_t maxCharacters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wraps enough of a loaded text to know the visible lines, the selected lines and the line below the selection point.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapNeededLines();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // To keep the drawing as fast as possible, all the calculation are done in front by this function.
         // It is called when the text changes, when scrolling, ...
@@ -557,10 +703,10 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called by updateDisplayedText and will split the text into five pieces so that the text can
-        // be easily drawn.
+        // This function is called by updateDisplayedText and creates the texts and selection backgrounds of the lines that
+        // are currently visible, so that only those lines have to be drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectionTexts(float maxLineWidth);
+        void updateVisibleLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,7 +716,8 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // When AnimationManager changes the elapsed time then this function is called.
+        // This function is called every half second while the text box is focused, to make the selection point blink.
+        // While a loaded text is still being wrapped, it is called every frame to wrap the next part of the text.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
@@ -604,11 +751,18 @@ namespace tgui
         sf::Vector2u m_Size;
 
         // Some information about the text
-        sf::String   m_Text;
-        sf::String   m_DisplayedText;
-        unsigned int m_TextSize;
-        unsigned int m_LineHeight;
-        unsigned int m_Lines;
+        TextBuffer      m_Text;
+        const sf::Font* m_TextFont;
+        unsigned int    m_TextSize;
+        unsigned int    m_LineHeight;
+        unsigned int    m_Lines;
+
+        // The index of the first character of every line and the line width for which they were calculated
+        std::vector<unsigned int> m_LineStarts;
+        float                     m_LineStartsWidth;
+
+        // Have all lines been wrapped? When a text is loaded, the last line start is where the wrapping will continue.
+        bool m_LineStartsComplete;
 
         // The maximum characters (0 by default, which means no limit)
         unsigned int m_MaxChars;
@@ -632,22 +786,25 @@ namespace tgui
         // The width in pixels of the flickering selection pointer
         unsigned int m_SelectionPointWidth;
 
-        // Should the text be resplit into the five texts?
+        // Should the texts of the visible lines be recreated? This is set when the text, the selection, the size or the
+        // scroll position changes. When only more of a loaded text got wrapped, the visible lines stay the same.
         bool m_SelectionTextsNeedUpdate;
 
         // The colors that are used by the text box
         sf::Color m_BackgroundColor;
+        sf::Color m_TextColor;
+        sf::Color m_SelectedTextColor;
         sf::Color m_SelectedTextBgrColor;
         sf::Color m_BorderColor;
 
-        // The sfml Text widgets
-        sf::Text m_TextBeforeSelection;
-        sf::Text m_TextSelection1;
-        sf::Text m_TextSelection2;
-        sf::Text m_TextAfterSelection1;
-        sf::Text m_TextAfterSelection2;
+        // The texts of the visible lines, a line consists of multiple texts when part of it is selected
+        std::vector<sf::Text> m_LineTexts;
+
+        // The backgrounds behind the selected part of the visible lines
+        std::vector<sf::FloatRect> m_SelectionRects;
 
-        std::vector<float> m_MultilineSelectionRectWidth;
+        // How far the visible lines are shifted, so that the text isn't drawn below the top of the text box
+        sf::Vector2f m_TextShift;
 
         // The scrollbar
         Scrollbar* m_Scroll;
@@ -0,0 +1,189 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_BUFFER_HPP
+#define TGUI_TEXT_BUFFER_HPP
+
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    /// \brief Storage for a long text that is edited one character at a time.
+    ///
+    /// The characters are stored as UTF-32 in a gap buffer: the unused part of the buffer is kept at the place where the last
+    /// edit happened. Typing or deleting next to the previous edit therefore doesn't move the rest of the text, only jumping
+    /// to another place in the text moves the characters that lie in between. Reading a character stays a single lookup.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextBuffer
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextBuffer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Constructor that fills the buffer with a text
+        ///
+        /// \param text  The initial contents of the buffer
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextBuffer(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Replaces the contents of the buffer.
+        ///
+        /// \param text  The new contents of the buffer
+        ///
+        /// \return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextBuffer& operator= (const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of characters in the buffer.
+        ///
+        /// \return Size of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Checks whether the buffer contains no characters.
+        ///
+        /// \return True when the text is empty
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a character from the buffer.
+        ///
+        /// \param index  Index of the character, which must be smaller than the size of the text
+        ///
+        /// \return The character at the given index
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Uint32 operator[] (std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Inserts a character into the buffer.
+        ///
+        /// \param position   Index in front of which the character is inserted
+        /// \param character  The character to insert
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Inserts a text into the buffer.
+        ///
+        /// \param position  Index in front of which the text is inserted
+        /// \param text      The text to insert
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Inserts UTF-32 characters into the buffer.
+        ///
+        /// \param position    Index in front of which the characters are inserted
+        /// \param characters  Pointer to the first character to insert
+        /// \param count       Amount of characters to insert
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, const sf::Uint32* characters, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes characters from the buffer.
+        ///
+        /// \param position  Index of the first character to remove
+        /// \param count     Amount of characters to remove, sf::String::InvalidPos removes everything behind the position
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t position, std::size_t count = 1);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all characters from the buffer.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Copies a part of the buffer into a string.
+        ///
+        /// \param start  Index of the first character to copy
+        /// \param end    Index behind the last character to copy, sf::String::InvalidPos copies until the end of the text
+        ///
+        /// \return The requested part of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getString(std::size_t start = 0, std::size_t end = sf::String::InvalidPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the gap in front of the given index and makes sure that it can hold at least the requested amount of characters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveGap(std::size_t position, std::size_t minimumSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The characters in front of the gap are stored at the start of the buffer, the others at the end
+        std::vector<sf::Uint32> m_Buffer;
+        std::size_t             m_GapStart;
+        std::size_t             m_GapEnd;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_BUFFER_HPP
@@ -0,0 +1,210 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_METRICS_HPP
+#define TGUI_TEXT_METRICS_HPP
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    /// \brief Measures text without having to create an sf::Text.
+    ///
+    /// For every combination of font and character size that is used, the advances of the characters and the kerning between
+    /// them are cached in a table. The advances of the characters in the Latin-1 range are stored in a plain array, other
+    /// characters and the kerning pairs are looked up in a hash map.
+    ///
+    /// The positions are calculated in the same way as sf::Text::findCharacterPos does, so the results match the text that
+    /// is drawn. A newline character starts a new line, so positions are always relative to the start of their line.
+    ///
+    /// The tables are identified by the address of the font. Every widget that measures its text with this class calls
+    /// removeFont when it is given a font, and containers call it when their global font changes or is destroyed. This way
+    /// a reloaded font, or a new font that ends up at the address of a destroyed one, never uses an old table.
+    /// This class may only be used from the gui thread.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextMetrics : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextMetrics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the horizontal distance that the pen moves after drawing a character.
+        ///
+        /// \param font           The font of the text
+        /// \param characterSize  The character size of the text
+        /// \param character      The character to measure
+        ///
+        /// \return Advance of the character (a tab counts as four spaces, a newline has no advance)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(const sf::Font& font, unsigned int characterSize, sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the kerning offset between two characters.
+        ///
+        /// \param font           The font of the text
+        /// \param characterSize  The character size of the text
+        /// \param first          The character on the left
+        /// \param second         The character on the right
+        ///
+        /// \return Offset that has to be added to the position of the second character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(const sf::Font& font, unsigned int characterSize, sf::Uint32 first, sf::Uint32 second);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the width of a part of the text.
+        ///
+        /// \param font           The font of the text
+        /// \param characterSize  The character size of the text
+        /// \param text           The text to measure
+        /// \param start          Index of the first character to measure
+        /// \param end            Index behind the last character to measure (clamped to the size of the text)
+        ///
+        /// \return Horizontal position behind the last character, relative to the start of the part (or to the start of the
+        ///         last line when the part contains a newline)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTextWidth(const sf::Font& font, unsigned int characterSize, const sf::String& text,
+                           std::size_t start = 0, std::size_t end = sf::String::InvalidPos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Calculates the horizontal position of every character in a part of the text.
+        ///
+        /// \param font           The font of the text
+        /// \param characterSize  The character size of the text
+        /// \param text           The text to measure
+        /// \param positions      Vector that is filled with end - start + 1 positions. The first one is always 0, the last one
+        ///                       is the position behind the last character.
+        /// \param start          Index of the first character to measure
+        /// \param end            Index behind the last character to measure (clamped to the size of the text)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getCharacterPositions(const sf::Font& font, unsigned int characterSize, const sf::String& text, std::vector<float>& positions,
+                                   std::size_t start = 0, std::size_t end = sf::String::InvalidPos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Finds the character that is closest to a horizontal position.
+        ///
+        /// \param font           The font of the text
+        /// \param characterSize  The character size of the text
+        /// \param text           The text to search in, which should not contain newlines between start and end
+        /// \param x              The horizontal position, relative to the start of the part
+        /// \param start          Index of the first character to search
+        /// \param end            Index behind the last character to search (clamped to the size of the text)
+        ///
+        /// \return Index of the character in front of which a caret placed at x should be shown, between start and end
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findCharacterIndex(const sf::Font& font, unsigned int characterSize, const sf::String& text, float x,
+                                       std::size_t start = 0, std::size_t end = sf::String::InvalidPos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Forgets everything that was cached for a font.
+        ///
+        /// \param font  The font that is about to be destroyed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFont(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Forgets everything that was cached.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The cached metrics of one font with one character size
+        struct Table
+        {
+            Table();
+
+            // The advances of the Latin-1 characters, negative when the character wasn't measured yet
+            float latinAdvances[256];
+
+            std::unordered_map<sf::Uint32, float> advances;
+            std::unordered_map<sf::Uint64, float> kerning;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the table for the font and character size, creating it when it doesn't exist yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Table& getTable(const sf::Font& font, unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the advance of a character, looking it up in the font when it isn't in the table yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float getAdvance(Table& table, const sf::Font& font, unsigned int characterSize, sf::Uint32 character);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the kerning between two characters, looking it up in the font when it isn't in the table yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float getKerning(Table& table, const sf::Font& font, unsigned int characterSize, sf::Uint32 first, sf::Uint32 second);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        std::map<std::pair<const sf::Font*, unsigned int>, Table> m_Tables;
+
+        // The table that was used last, because the same text is usually measured a few times in a row
+        const sf::Font* m_LastFont;
+        unsigned int    m_LastCharacterSize;
+        Table*          m_LastTable;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_METRICS_HPP
@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <list>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,15 +37,34 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /// \internal
+    // A large texture in which the images are packed when the atlas mode of the texture manager is enabled
+    struct AtlasPage
+    {
+        sf::Texture   texture;
+
+        // The skyline of the packer, each element is the x position, the y position and the width of a segment
+        std::vector<sf::Vector3i> skyline;
+
+        // The amount of images that are stored in this page
+        unsigned int  images;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     struct TextureData
     {
-        TextureData() : image(nullptr) {}
+        TextureData() : image(nullptr), page(nullptr) {}
 
         sf::Image*    image;
         sf::Texture   texture;
         sf::IntRect   rect;
         std::string   filename;
         unsigned int  users;
+
+        // When the image is stored in an atlas page then the texture above is only created when really needed
+        AtlasPage*    page;
+        sf::IntRect   atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,12 +78,26 @@ namespace tgui
         sf::Vector2u getSize() const;
         bool isTransparentPixel(unsigned int x, unsigned int y);
 
+        // The rect is relative to the loaded image part, also when the texture is stored in an atlas page
+        void setTextureRect(const sf::IntRect& rect);
+        sf::IntRect getTextureRect() const;
+
+        // A texture that has to be smoothed can't stay inside an atlas page and will get its own texture.
+        // A repeated texture stays in the atlas page, the renderer draws it as multiple tiles instead.
+        void setRepeated(bool repeat);
+        void setSmooth(bool smooth);
+        bool isSmooth() const;
+
+        bool isInAtlas() const;
+        void detachFromAtlas();
+
         operator const sf::Sprite&() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         TextureData* data;
         sf::Sprite   sprite;
+        bool         repeated;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +106,13 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureManager();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Loads a texture.
         ///
@@ -106,16 +147,81 @@ namespace tgui
         void removeTexture(Texture& textureToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Packs the images that are loaded from now on into a few large textures.
+        ///
+        /// \param pageSize  Width and height of the atlas pages. It will be reduced when the graphics card doesn't support it.
+        ///
+        /// The widgets can then be drawn with far less draw calls, because they will mostly use the same texture.
+        /// Images that are larger than the page size will still get their own texture.
+        /// Images that were already loaded before calling this function will not be moved into the atlas.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableAtlas(unsigned int pageSize = 1024);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Images that are loaded from now on will get their own texture again (default).
+        ///
+        /// Images that were already packed in the atlas will stay there until they are no longer used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableAtlas();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of atlas pages that are currently in use.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getAtlasPageCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         struct ImageMapData
         {
+            ImageMapData() : page(nullptr) {}
+
             sf::Image image;
             std::list<TextureData> data;
+
+            // The place of the whole image in the atlas when it was packed
+            AtlasPage*   page;
+            sf::Vector2i atlasPosition;
         };
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds a place in one of the atlas pages and copies the image into it.
+        // Returns false when the image doesn't fit, in which case it has to use its own texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addToAtlas(const sf::Image& image, AtlasPage*& page, sf::Vector2i& position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the lowest place in the skyline of the page where a rectangle of the given size fits.
+        // Returns the index of the skyline segment, or -1 when it doesn't fit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findSkylinePosition(const AtlasPage& page, unsigned int width, unsigned int height, int& y) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the image from memory together with the atlas page when it was the last image in it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeImage(std::map<std::string, ImageMapData>::iterator imageIt);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
         std::map<std::string, ImageMapData> m_ImageMap;
+
+        // The pages are stored in a list because the texture data keeps pointers to them
+        std::list<AtlasPage> m_AtlasPages;
+
+        bool         m_AtlasEnabled;
+        unsigned int m_AtlasPageSize;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
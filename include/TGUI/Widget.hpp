@@ -27,6 +27,9 @@
 #define TGUI_WIDGETS_HPP
 
 
+#include <list>
+#include <atomic>
+
 #include <TGUI/Global.hpp>
 #include <TGUI/ConfigFile.hpp>
 #include <TGUI/Callback.hpp>
@@ -38,6 +41,7 @@
 namespace tgui
 {
     class Container;
+    class GuiContainer;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The parent class for every widget.
@@ -72,6 +76,13 @@ namespace tgui
         virtual ~Widget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Widgets are allocated from pools per widget size, or from the active WidgetArena.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* operator new(std::size_t size);
+        static void operator delete(void* widget, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Overload of assignment operator
         ///
@@ -89,6 +100,23 @@ namespace tgui
         virtual Widget* clone() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// \param x X coordinate of the new position
+        /// \param y Y coordinate of the new position
+        ///
+        /// \see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(float x, float y);
+        using Transformable::setPosition;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the absolute position of the widget on the screen
         ///
@@ -98,6 +126,18 @@ namespace tgui
         virtual sf::Vector2f getAbsolutePosition() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area that the widget covers when it is drawn.
+        ///
+        /// The rectangle is in the coordinate system of the parent, so the position of the widget is included.
+        /// Containers use it to skip widgets that lie completely outside the visible area.
+        ///
+        /// \return Bounding box of the widget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Shows the widget.
         ///
@@ -296,18 +336,57 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called right after the elapsed time is changed.
-        // The elapsed time is only changed when the widget has set m_AnimatedWidget to true.
+        // This function is called by the gui when the delay that was passed to scheduleUpdate has passed. Before it is
+        // called, the time that passed since the update was scheduled is added to the elapsed time.
+        // Widgets that set m_AnimatedWidget to true before being added to a gui still get this call every frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the gui to call the update function after the given delay. A widget only has one scheduled update, calling
+        // this function again replaces the previous one. When the widget isn't part of a gui yet then the update will be
+        // scheduled when it is added to one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(const sf::Time& delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the gui that the widget has changed and that it has to be drawn again.
+        ///
+        /// The widgets call this function themselves whenever something changes that affects the way they look.
+        /// You only need to call it when you changed something yourself that the widget can't know about,
+        /// e.g. when you draw on the texture that you passed to a Picture.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Same as invalidate, but also tells the parent that the position or size of the widget may have changed, so that the
+        // widget is moved to the correct cells of the spatial index. Only the functions that change the bounds call this.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateBounds();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // The widgets use this function to send their callbacks to their parent and/or to a callback function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addCallback();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the callback that is stored in m_Callback to the bound functions and/or to the parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sendCallback();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the callbacks that were held back because their trigger is coalesced. The gui calls this once per frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sendCoalescedCallbacks();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse enters the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +487,13 @@ namespace tgui
         virtual void initialize(Container *const container);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the widget or one of its parents has moved. The cached absolute position of the
+        // widget will be recalculated the next time that it is needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void absolutePositionChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -444,6 +530,10 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_Parent;
 
+        // The position of the widget on the screen, it is only recalculated after the widget or one of its parents moved
+        mutable sf::Vector2f m_AbsolutePosition;
+        mutable bool         m_AbsolutePositionNeedsUpdate;
+
         // How transparent is the widget
         unsigned char m_Opacity;
 
@@ -458,19 +548,41 @@ namespace tgui
         bool m_AllowFocus;
 
         // Keep track of the elapsed time.
+        // Setting m_AnimatedWidget is the old way to be updated every frame, new widgets should call scheduleUpdate instead.
         bool m_AnimatedWidget;
         sf::Time m_AnimationTimeElapsed;
 
+        // Does the widget want its update function to be called? When the update has been scheduled in a gui then that
+        // gui is stored, together with the time on its clock at which the update will happen.
+        bool          m_UpdateScheduled;
+        sf::Time      m_UpdateDelay;
+        sf::Time      m_UpdateTime;
+        GuiContainer* m_UpdateScheduler;
+
+        // The gui that will send the coalesced callbacks of this widget, when there are any waiting to be sent
+        GuiContainer* m_CoalescedCallbackScheduler;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_DraggableWidget;
 
         // This is set to true for widgets that store other widgets inside them
         bool m_ContainerWidget;
 
+        // The amount of SharedWidgetPtr objects that point to this widget. The widget is destroyed when it reaches 0.
+#ifdef TGUI_THREAD_SAFE_REFCOUNT
+        std::atomic<unsigned int> m_RefCount;
+#else
+        unsigned int m_RefCount;
+#endif
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
+        friend class GuiContainer;
+
+        template <class T>
+        friend class SharedWidgetPtr;
     };
 
 
@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WIDGET_ARENA_HPP
+#define TGUI_WIDGET_ARENA_HPP
+
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory region from which a whole form of widgets can be allocated and released at once.
+    ///
+    /// Widgets are normally allocated from pools that keep a list of free slots for every widget size, so that creating and
+    /// destroying widgets doesn't go to the system allocator every time. While a WidgetArena::Scope exists, the widgets
+    /// that are created on that thread are instead placed behind each other in large blocks owned by the arena.
+    /// Destroying such a widget doesn't free any memory, all blocks are released together when the arena is destroyed.
+    ///
+    /// The widgets that were allocated from the arena should be destroyed before the arena itself, e.g. by removing them
+    /// from the gui. Widgets that still exist keep the memory alive, it is then released together with the last of them.
+    ///
+    /// Usage example:
+    /// \code
+    /// tgui::WidgetArena arena;
+    /// {
+    ///     tgui::WidgetArena::Scope scope(arena);
+    ///     gui.loadWidgetsFromFile("form.txt");
+    /// }
+    /// ...
+    /// gui.removeAllWidgets();
+    /// // The arena can now be destroyed
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetArena : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes an arena the place where new widgets are allocated, for as long as the scope exists.
+        ///
+        /// Only the widgets that are created on the thread that created the scope are affected.
+        /// Scopes can be nested, the previous arena is used again when the scope is destroyed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope : public sf::NonCopyable
+        {
+          public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// \brief Constructor
+            ///
+            /// \param arena  The arena from which the widgets should be allocated
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Scope(WidgetArena& arena);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// \brief Destructor
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+
+          private:
+
+            WidgetArena* m_PreviousArena;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// \param blockSize  Size in bytes of the blocks that are allocated from the system
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetArena(std::size_t blockSize = 64 * 1024);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Releases all memory of the arena, or leaves that to the last of its widgets when some of them still exist.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WidgetArena();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of widgets allocated from the arena that still exist.
+        ///
+        /// \return Amount of living widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The blocks of an arena. They are kept alive until both the arena and all widgets allocated from it are destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Memory;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns memory for a widget of the given size. The size already includes the room for the allocation header.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void* allocate(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the memory of the arena, which is stored in the header of every widget that is allocated from it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Memory* getMemory() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a widget of an arena was destroyed. The memory is released when both the arena and all of its widgets
+        // are gone, which can happen from here when the arena was destroyed before its last widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void deallocate(Memory* memory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the arena of the scope that is active on this thread, or nullptr when there is none.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static WidgetArena* getActiveArena();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        Memory* m_Memory;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Allocates the memory for a widget, from the active arena or otherwise from the pool of the given size.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void* allocateWidget(std::size_t size);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Returns the memory of a widget to the place where it was allocated from. The size must match the allocated size.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void deallocateWidget(void* widget, std::size_t size);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_ARENA_HPP
@@ -39,7 +39,6 @@ namespace tgui
     m_Looping        (false)
     {
         m_Callback.widgetType = Type_AnimatedPicture;
-        m_AnimatedWidget = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +89,10 @@ namespace tgui
             std::swap(m_CurrentFrame,    temp.m_CurrentFrame);
             std::swap(m_Playing,         temp.m_Playing);
             std::swap(m_Looping,         temp.m_Looping);
+
+            // Continue playing where the other animation was
+            if (m_Playing)
+                scheduleUpdate(sf::Time());
         }
 
         return *this;
@@ -106,6 +109,8 @@ namespace tgui
 
     bool AnimatedPicture::addFrame(const std::string& filename, sf::Time frameDuration)
     {
+        invalidate();
+
         // Check if the filename is empty
         if (filename.empty())
             return false;
@@ -142,6 +147,8 @@ namespace tgui
 
     void AnimatedPicture::setSize(float width, float height)
     {
+        invalidateBounds();
+
         m_Size.x = width;
         m_Size.y = height;
     }
@@ -160,6 +167,8 @@ namespace tgui
 
     void AnimatedPicture::play()
     {
+        invalidate();
+
         // You can't start playing when no frames were loaded
         if (m_Textures.empty())
             return;
@@ -169,12 +178,17 @@ namespace tgui
 
         // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
+
+        // Wake up when the next frame has to be shown
+        scheduleUpdate(m_FrameDuration[m_CurrentFrame]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::pause()
     {
+        invalidate();
+
         m_Playing = false;
     }
 
@@ -182,6 +196,8 @@ namespace tgui
 
     void AnimatedPicture::stop()
     {
+        invalidate();
+
         m_Playing = false;
 
         if (m_Textures.empty())
@@ -194,6 +210,8 @@ namespace tgui
 
     bool AnimatedPicture::setFrame(unsigned int frame)
     {
+        invalidate();
+
         // Check if there are no frames
         if (m_Textures.empty() == true)
         {
@@ -245,6 +263,8 @@ namespace tgui
 
     bool AnimatedPicture::removeFrame(unsigned int frame)
     {
+        invalidate();
+
         // Make sure the number isn't too high
         if (frame >= m_Textures.size())
             return false;
@@ -269,6 +289,8 @@ namespace tgui
 
     void AnimatedPicture::removeAllFrames()
     {
+        invalidate();
+
         // Remove the textures (if we are the only one using it)
         for (unsigned int i=0; i< m_Textures.size(); ++i)
             TGUI_TextureManager.removeTexture(m_Textures[i]);
@@ -286,6 +308,8 @@ namespace tgui
 
     void AnimatedPicture::setLooping(bool loop)
     {
+        invalidate();
+
         m_Looping = loop;
     }
 
@@ -307,6 +331,8 @@ namespace tgui
 
     void AnimatedPicture::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         for (unsigned int i = 0; i < m_Textures.size(); ++i)
@@ -322,7 +348,10 @@ namespace tgui
         if (property == "playing")
         {
             if ((value == "true") || (value == "True"))
+            {
                 m_Playing = true;
+                scheduleUpdate(sf::Time());
+            }
             else if ((value == "false") || (value == "False"))
                 m_Playing = false;
             else
@@ -374,7 +403,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(AnimationFinished) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(AnimationFinished).size() == 1) && (m_CallbackFunctions.at(AnimationFinished).front() == nullptr))
+            if (isCallbackBoundToParentOnly(AnimationFinished))
                 callbacks.push_back("AnimationFinished");
 
             encodeList(callbacks, value);
@@ -406,7 +435,7 @@ namespace tgui
     void AnimatedPicture::update()
     {
         // Only continue when you are playing
-        if (m_Playing == false)
+        if ((m_Playing == false) || m_Textures.empty())
             return;
 
         // Check if the next frame should be displayed
@@ -417,6 +446,7 @@ namespace tgui
             {
                 // Decrease the elapsed time
                 m_AnimationTimeElapsed -= m_FrameDuration[m_CurrentFrame];
+                invalidate();
 
                 // Make the next frame visible
                 if (static_cast<unsigned int>(m_CurrentFrame + 1) < m_Textures.size())
@@ -434,7 +464,7 @@ namespace tgui
                     }
 
                     // The animation has finished, send a callback if needed
-                    if (m_CallbackFunctions[AnimationFinished].empty() == false)
+                    if (isCallbackBound(AnimationFinished))
                     {
                         m_Callback.trigger = AnimationFinished;
                         addCallback();
@@ -445,6 +475,10 @@ namespace tgui
             else // The frame has to remain visible
                 m_AnimationTimeElapsed = sf::Time();
         }
+
+        // Wake up again when the next frame has to be shown
+        if (m_Playing && (m_FrameDuration[m_CurrentFrame].asMicroseconds() > 0))
+            scheduleUpdate(m_FrameDuration[m_CurrentFrame] - m_AnimationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -455,7 +489,7 @@ namespace tgui
         {
             states.transform *= getTransform();
             states.transform.scale(m_Size.x / m_Textures[m_CurrentFrame].getSize().x, m_Size.y / m_Textures[m_CurrentFrame].getSize().y);
-            target.draw(m_Textures[m_CurrentFrame], states);
+            TGUI_Renderer.draw(target, m_Textures[m_CurrentFrame], states);
         }
     }
 
@@ -131,6 +131,8 @@ namespace tgui
 
     bool Button::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -336,7 +338,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -350,19 +352,19 @@ namespace tgui
                 m_AllowFocus = true;
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
             if ((m_TextureDown_L.data != nullptr) && (m_TextureDown_M.data != nullptr) && (m_TextureDown_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_MouseDown;
 
-                m_TextureDown_M.data->texture.setRepeated(true);
+                m_TextureDown_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -409,7 +411,7 @@ namespace tgui
 
     void Button::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         if (m_SplitImage)
         {
@@ -458,6 +460,8 @@ namespace tgui
 
     void Button::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -488,10 +492,10 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureDown_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureDown_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureDown_M.sprite.setScale(scalingY, scalingY);
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
@@ -519,6 +523,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -560,6 +566,8 @@ namespace tgui
 
     void Button::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
     }
 
@@ -574,6 +582,8 @@ namespace tgui
 
     void Button::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Text.setColor(color);
     }
 
@@ -588,6 +598,8 @@ namespace tgui
 
     void Button::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -607,6 +619,8 @@ namespace tgui
 
     void Button::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
@@ -636,7 +650,7 @@ namespace tgui
         if (event.code == sf::Keyboard::Space)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 addCallback();
@@ -645,7 +659,7 @@ namespace tgui
         else if (event.code == sf::Keyboard::Return)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 addCallback();
@@ -729,9 +743,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(SpaceKeyPressed))
                 callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -778,53 +792,53 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_L, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_M, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_R, states);
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_L, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_L, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_M, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_L, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_R, states);
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_R, states);
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_L, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_M, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_R, states);
             }
         }
         else // The images aren't split
@@ -833,44 +847,44 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_M, states);
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    TGUI_Renderer.draw(target, m_TextureDown_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_M, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_M, states);
             }
         }
 
         // If the button has a text then also draw the text
-        target.draw(m_Text, states);
+        TGUI_Renderer.draw(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    CallbackManager::CallbackManager() :
+    m_BoundTriggers    (0),
+    m_CoalescedTriggers(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CallbackManager::bindCallback(std::function<void()> func, unsigned int trigger)
     {
         mapCallback(func, trigger);
@@ -54,19 +62,14 @@ namespace tgui
 
     void CallbackManager::unbindCallback(unsigned int trigger)
     {
-        unsigned int counter = 1;
-        while (counter * 2 <= trigger)
-            counter *= 2;
-
-        while (counter > 0)
+        trigger &= m_BoundTriggers;
+        while (trigger)
         {
-            if (trigger >= counter)
-            {
-                m_CallbackFunctions.erase(counter);
-                trigger -= counter;
-            }
+            const unsigned int index = getTriggerIndex(trigger);
+            m_CallbackFunctions[index].clear();
 
-            counter /= 2;
+            m_BoundTriggers &= ~(1u << index);
+            trigger &= ~(1u << index);
         }
     }
 
@@ -75,29 +78,171 @@ namespace tgui
     void CallbackManager::unbindAllCallback()
     {
         m_CallbackFunctions.clear();
+        m_BoundTriggers = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackManager::setCallbackCoalescing(unsigned int trigger, bool coalesce)
+    {
+        if (coalesce)
+            m_CoalescedTriggers |= trigger;
+        else
+            m_CoalescedTriggers &= ~trigger;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void CallbackManager::mapCallback(const std::function<void()>& function, unsigned int trigger)
     {
-        unsigned int counter = 1;
-        while (counter * 2 <= trigger)
-            counter *= 2;
+        while (trigger)
+        {
+            const unsigned int index = getTriggerIndex(trigger);
+            if (index >= m_CallbackFunctions.size())
+                m_CallbackFunctions.resize(index + 1);
+
+            m_CallbackFunctions[index].push_back(function);
+
+            m_BoundTriggers |= (1u << index);
+            trigger &= ~(1u << index);
+        }
+    }
 
-        while (counter > 0)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CallbackManager::isCallbackBoundToParentOnly(unsigned int trigger) const
+    {
+        if (!isCallbackBound(trigger))
+            return false;
+
+        const auto& functions = getCallbackFunctions(trigger);
+        return (functions.size() == 1) && (functions.front() == nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::function<void()>>& CallbackManager::getCallbackFunctions(unsigned int trigger) const
+    {
+        return m_CallbackFunctions[getTriggerIndex(trigger)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int CallbackManager::getTriggerIndex(unsigned int trigger)
+    {
+        unsigned int index = 0;
+        while (((trigger >> index) & 1) == 0)
+            ++index;
+
+        return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CallbackQueue::CallbackQueue(std::size_t capacity) :
+    m_Mask      (0),
+    m_Head      (0),
+    m_Tail      (0),
+    m_ThreadSafe(false)
+    {
+        std::size_t size = 1;
+        while (size < capacity)
+            size *= 2;
+
+        m_Buffer.resize(size);
+        m_Mask = size - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackQueue::push(const Callback& callback)
+    {
+        // Older callbacks that didn't fit have to go first, otherwise the order would change
+        flush();
+
+        if (!m_Overflow.empty() || !pushToRingBuffer(callback))
+            m_Overflow.push_back(callback);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CallbackQueue::pop(Callback& callback)
+    {
+        return pop(&callback, 1) == 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CallbackQueue::pop(Callback* callbacks, std::size_t maxCount)
+    {
+        std::size_t count = 0;
+        while (count < maxCount)
         {
-            if (trigger >= counter)
+            // When everything happens on the same thread, the callbacks that were set aside can be moved to the ring buffer here
+            if (!m_ThreadSafe)
+                flush();
+
+            std::size_t head = m_Head.load(std::memory_order_relaxed);
+            const std::size_t tail = m_Tail.load(std::memory_order_acquire);
+            if (head == tail)
+                break;
+
+            while ((count < maxCount) && (head != tail))
             {
-                m_CallbackFunctions[counter].push_back(function);
-                trigger -= counter;
+                callbacks[count] = std::move(m_Buffer[head & m_Mask]);
+                ++count;
+                ++head;
             }
 
-            counter /= 2;
+            // Hand the slots back to the producer
+            m_Head.store(head, std::memory_order_release);
         }
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackQueue::flush()
+    {
+        while (!m_Overflow.empty() && pushToRingBuffer(m_Overflow.front()))
+            m_Overflow.pop_front();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackQueue::setThreadSafe(bool threadSafe)
+    {
+        m_ThreadSafe = threadSafe;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CallbackQueue::isThreadSafe() const
+    {
+        return m_ThreadSafe;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CallbackQueue::pushToRingBuffer(const Callback& callback)
+    {
+        const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const std::size_t head = m_Head.load(std::memory_order_acquire);
+
+        // Check if the ring buffer is full
+        if (tail - head == m_Buffer.size())
+            return false;
+
+        // The slots are preallocated, so no memory is allocated here unless the text of the callback needs it
+        m_Buffer[tail & m_Mask] = callback;
+
+        // Only publish the callback after it has been written
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,7 +81,7 @@ namespace tgui
 
     void Canvas::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_sprite.setPosition(x, y);
     }
@@ -90,6 +90,8 @@ namespace tgui
 
     void Canvas::setSize(float width, float height)
     {
+        invalidateBounds();
+
         m_renderTexture.create(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
         m_sprite.setTexture(m_renderTexture.getTexture(), true);
 
@@ -129,6 +131,8 @@ namespace tgui
 
     void Canvas::display()
     {
+        invalidate();
+
         m_renderTexture.display();
     }
 
@@ -136,7 +140,7 @@ namespace tgui
 
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_sprite, states);
+        TGUI_Renderer.draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
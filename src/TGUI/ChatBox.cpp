@@ -23,13 +23,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <TGUI/Label.hpp>
 #include <TGUI/Panel.hpp>
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChatBox.hpp>
 
 #include <cmath>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -70,7 +70,8 @@ namespace tgui
         m_BorderColor         (copy.m_BorderColor),
         m_MaxLines            (copy.m_MaxLines),
         m_FullTextHeight      (copy.m_FullTextHeight),
-        m_LinesStartFromBottom(copy.m_LinesStartFromBottom)
+        m_LinesStartFromBottom(copy.m_LinesStartFromBottom),
+        m_Lines               (copy.m_Lines)
     {
         m_Panel = new Panel(*copy.m_Panel);
 
@@ -79,6 +80,9 @@ namespace tgui
             m_Scroll = new Scrollbar(*copy.m_Scroll);
         else
             m_Scroll = nullptr;
+
+        // The texts of the visible lines can't be copied, they use the font of the panel of the original chat box
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +120,8 @@ namespace tgui
             std::swap(m_MaxLines,             temp.m_MaxLines);
             std::swap(m_FullTextHeight,       temp.m_FullTextHeight);
             std::swap(m_LinesStartFromBottom, temp.m_LinesStartFromBottom);
+            std::swap(m_Lines,                temp.m_Lines);
+            std::swap(m_VisibleLines,         temp.m_VisibleLines);
             std::swap(m_Panel,                temp.m_Panel);
             std::swap(m_Scroll,               temp.m_Scroll);
         }
@@ -134,6 +140,8 @@ namespace tgui
 
     bool ChatBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -237,6 +245,8 @@ namespace tgui
 
     void ChatBox::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -264,13 +274,9 @@ namespace tgui
             m_Scroll->setSize(m_Scroll->getSize().x, m_Panel->getSize().y);
         }
 
-        // Find out how much the height has changed
-        float heightDiff = m_Panel->getSize().y - oldHeight;
-
-        // Reposition all labels in the chatbox
-        auto& labels = m_Panel->getWidgets();
-        for (auto it = labels.begin(); it != labels.end(); ++it)
-            (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y + heightDiff);
+        // Reposition the lines when the height has changed
+        if (m_Panel->getSize().y != oldHeight)
+            updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,8 +296,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect ChatBox::getBounds() const
+    {
+        // The borders are drawn outside the chat box
+        return sf::FloatRect(getPosition().x - m_LeftBorder, getPosition().y - m_TopBorder, getFullSize().x, getFullSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::addLine(const sf::String& text)
     {
+        invalidate();
+
         addLine(text, m_TextColor, m_TextSize);
     }
 
@@ -299,6 +315,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color)
     {
+        invalidate();
+
         addLine(text, color, m_TextSize);
     }
 
@@ -306,6 +324,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, unsigned int textSize)
     {
+        invalidate();
+
         addLine(text, m_TextColor, textSize);
     }
 
@@ -313,58 +333,59 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
     {
-        auto& widgets = m_Panel->getWidgets();
+        invalidate();
 
-        // Remove the top line if you exceed the maximum
-        if ((m_MaxLines > 0) && (m_MaxLines < widgets.size() + 1))
-            removeLine(0);
+        // The font may have been reloaded, or it may be a new font at the address of a destroyed one
+        if (font != nullptr)
+            TGUI_TextMetrics.removeFont(*font);
 
-        Label::Ptr label(*m_Panel);
-        label->setTextColor(color);
-        label->setTextSize(textSize);
+        appendLine(text, color, textSize, font);
 
-        if (font != nullptr)
-            label->setTextFont(*font);
+        // Scroll down to the new line and reposition the lines
+        updateScrollbarAfterAddingLines();
+        updateDisplayedText();
+    }
 
-        Label::Ptr tempLine;
-        tempLine->setTextSize(textSize);
-        tempLine->setTextFont(*label->getTextFont());
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        float width = m_Panel->getSize().x;
-        if (m_Scroll)
-            width -= m_Scroll->getSize().x;
+    void ChatBox::addLines(const sf::String& text)
+    {
+        invalidate();
 
-        if (width < 0)
-            width = 0;
+        addLines(text, m_TextColor, m_TextSize);
+    }
 
-        // Split the label over multiple lines if necessary
-        unsigned int pos = 0;
-        unsigned int size = 0;
-        while (pos + size < text.getSize())
-        {
-            tempLine->setText(text.toWideString().substr(pos, ++size));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            if (tempLine->getSize().x + 4.0f > width)
-            {
-                label->setText(label->getText() + text.toWideString().substr(pos, size - 1) + "\n");
+    void ChatBox::addLines(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
+    {
+        invalidate();
 
-                pos = pos + size - 1;
-                size = 0;
-            }
+        // The font may have been reloaded, or it may be a new font at the address of a destroyed one
+        if (font != nullptr)
+            TGUI_TextMetrics.removeFont(*font);
+
+        // Find where each of the lines starts
+        std::vector<std::size_t> lineStarts(1, 0);
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            if (text[i] == '\n')
+                lineStarts.push_back(i + 1);
         }
-        label->setText(label->getText() + tempLine->getText());
 
-        m_FullTextHeight += getLineSpacing(widgets.size()-1);
+        // Lines that would immediately be removed again because of the line limit don't have to be added
+        std::size_t firstLine = 0;
+        if ((m_MaxLines > 0) && (lineStarts.size() > m_MaxLines))
+            firstLine = lineStarts.size() - m_MaxLines;
 
-        if (m_Scroll != nullptr)
+        for (std::size_t i = firstLine; i < lineStarts.size(); ++i)
         {
-            m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
-
-            if (m_Scroll->getMaximum() > m_Scroll->getLowValue())
-                m_Scroll->setValue(m_Scroll->getMaximum() - m_Scroll->getLowValue());
+            std::size_t lineEnd = (i + 1 < lineStarts.size()) ? lineStarts[i+1] - 1 : text.getSize();
+            appendLine(std::basic_string<sf::Uint32>(text.begin() + lineStarts[i], text.begin() + lineEnd), color, textSize, font);
         }
 
-        // Reposition the labels
+        // Scroll down to the new lines and reposition the lines
+        updateScrollbarAfterAddingLines();
         updateDisplayedText();
     }
 
@@ -372,9 +393,9 @@ namespace tgui
 
     sf::String ChatBox::getLine(unsigned int lineIndex)
     {
-        if (lineIndex < m_Panel->getWidgets().size())
+        if (lineIndex < m_Lines.size())
         {
-            return tgui::Label::Ptr(m_Panel->getWidgets()[lineIndex])->getText();
+            return m_Lines[lineIndex].text;
         }
         else // Index too high
             return "";
@@ -384,11 +405,22 @@ namespace tgui
 
     bool ChatBox::removeLine(unsigned int lineIndex)
     {
-        if (lineIndex < m_Panel->getWidgets().size())
+        invalidate();
+
+        if (lineIndex < m_Lines.size())
         {
-            tgui::Label::Ptr label = m_Panel->getWidgets()[lineIndex];
-            m_FullTextHeight -= getLineSpacing(lineIndex);
-            m_Panel->remove(label);
+            const unsigned int removedHeight = m_Lines[lineIndex].height;
+            m_FullTextHeight -= removedHeight;
+
+            // Removing the front line doesn't require the other lines to be moved
+            if (lineIndex == 0)
+                m_Lines.pop_front();
+            else
+            {
+                m_Lines.erase(m_Lines.begin() + lineIndex);
+                for (auto it = m_Lines.begin() + lineIndex; it != m_Lines.end(); ++it)
+                    it->top -= removedHeight;
+            }
 
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
@@ -404,7 +436,9 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
-        m_Panel->removeAllWidgets();
+        invalidate();
+
+        m_Lines.clear();
 
         m_FullTextHeight = 0;
 
@@ -418,21 +452,23 @@ namespace tgui
 
     unsigned int ChatBox::getLineAmount()
     {
-        return m_Panel->getWidgets().size();
+        return m_Lines.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::setLineLimit(unsigned int maxLines)
     {
+        invalidate();
+
         m_MaxLines = maxLines;
 
-        if ((m_MaxLines > 0) && (m_MaxLines < m_Panel->getWidgets().size()))
+        if ((m_MaxLines > 0) && (m_MaxLines < m_Lines.size()))
         {
-            while (m_MaxLines < m_Panel->getWidgets().size())
+            while (m_MaxLines < m_Lines.size())
             {
-                m_FullTextHeight -= getLineSpacing(0);
-                m_Panel->remove(m_Panel->getWidgets()[0]);
+                m_FullTextHeight -= m_Lines.front().height;
+                m_Lines.pop_front();
             }
 
             if (m_Scroll != nullptr)
@@ -446,11 +482,15 @@ namespace tgui
 
     void ChatBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Panel->setGlobalFont(font);
 
-        auto& labels = m_Panel->getWidgets();
-        for (auto it = labels.begin(); it != labels.end(); ++it)
-            Label::Ptr(*it)->setTextFont(font);
+        // All lines will now use the new font
+        for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+            it->font = nullptr;
+
+        recalculateLineHeights();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -464,6 +504,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -483,6 +525,8 @@ namespace tgui
 
     void ChatBox::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TextColor = color;
     }
 
@@ -497,6 +541,8 @@ namespace tgui
 
     void ChatBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidateBounds();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -507,6 +553,8 @@ namespace tgui
 
     void ChatBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_Panel->setBackgroundColor(backgroundColor);
     }
 
@@ -514,6 +562,8 @@ namespace tgui
 
     void ChatBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -535,15 +585,19 @@ namespace tgui
 
     void ChatBox::setLineSpacing(unsigned int lineSpacing)
     {
+        invalidate();
+
         m_LineSpacing = lineSpacing;
 
-        updateDisplayedText();
+        recalculateLineHeights();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::setLinesStartFromBottom(bool startFromBottom)
     {
+        invalidate();
+
         m_LinesStartFromBottom = startFromBottom;
 
         updateDisplayedText();
@@ -553,6 +607,8 @@ namespace tgui
 
     bool ChatBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -579,6 +635,7 @@ namespace tgui
             m_Scroll->setLowValue(static_cast<unsigned int>(m_Panel->getSize().y));
             m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
+            updateDisplayedText();
             return true;
         }
     }
@@ -587,15 +644,21 @@ namespace tgui
 
     void ChatBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
+
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_Panel->setTransparency(transparency);
@@ -641,6 +704,8 @@ namespace tgui
 
     void ChatBox::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -674,6 +739,8 @@ namespace tgui
 
     void ChatBox::leftMouseReleased(float x, float y)
     {
+        invalidate();
+
         // If there is a scrollbar then pass it the event
         if (m_Scroll != nullptr)
         {
@@ -751,13 +818,22 @@ namespace tgui
 
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_Scroll->getValue())
+                {
+                    invalidate();
                     updateDisplayedText();
+                }
             }
             else // You are just moving the mouse
             {
+                const bool scrollbarHovered = m_Scroll->m_MouseHover;
+
                 // When the mouse is on top of the scrollbar then pass the mouse move event
                 if (m_Scroll->mouseOnWidget(x, y))
                     m_Scroll->mouseMoved(x, y);
+
+                // The scrollbar looks different while the mouse is on top of it
+                if (m_Scroll->m_MouseHover != scrollbarHovered)
+                    invalidate();
             }
 
             // Reset the position
@@ -792,6 +868,8 @@ namespace tgui
 
     void ChatBox::mouseWheelMoved(int delta, int, int)
     {
+        invalidate();
+
         // Only do something when there is a scrollbar
         if (m_Scroll != nullptr)
         {
@@ -911,10 +989,8 @@ namespace tgui
         else if (property == "lines")
         {
             std::vector<sf::String> lines;
-            std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
-
-            for (auto it = labels.cbegin(); it != labels.cend(); ++it)
-                lines.push_back("(" + Label::Ptr(*it)->getText() + "," + convertColorToString(Label::Ptr(*it)->getTextColor()) + ")");
+            for (auto it = m_Lines.cbegin(); it != m_Lines.cend(); ++it)
+                lines.push_back("(" + it->text + "," + convertColorToString(it->color) + ")");
 
             encodeList(lines, value);
         }
@@ -941,25 +1017,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int ChatBox::getLineSpacing(unsigned int lineNumber)
+    unsigned int ChatBox::getLineSpacing(const Line& line) const
     {
-        assert(lineNumber < m_Panel->getWidgets().size());
-
-        auto line = tgui::Label::Ptr(m_Panel->getWidgets()[lineNumber]);
-
-        // Count the amount of lines that the label is taking
-        std::string lineText = line->getText().toAnsiString();
-        int linesOfText = std::count(lineText.begin(), lineText.end(), '\n') + 1;
-
         // If a line spacing was manually set then just return that one
         if (m_LineSpacing > 0)
-            return m_LineSpacing * linesOfText;
+            return m_LineSpacing * line.linesOfText;
+
+        const sf::Font& font = (line.font != nullptr) ? *line.font : m_Panel->getGlobalFont();
 
-        unsigned int lineSpacing = m_Panel->getGlobalFont().getLineSpacing(line->getTextSize());
-        if (lineSpacing > line->getTextSize())
-            return lineSpacing * linesOfText;
+        unsigned int lineSpacing = font.getLineSpacing(line.textSize);
+        if (lineSpacing > line.textSize)
+            return lineSpacing * line.linesOfText;
         else
-            return static_cast<unsigned int>(std::ceil(line->getTextSize() * 13.5 / 10.0) * linesOfText);
+            return static_cast<unsigned int>(std::ceil(line.textSize * 13.5 / 10.0) * line.linesOfText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::recalculateLineHeights()
+    {
+        unsigned int top = 0;
+        for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+        {
+            it->top = top;
+            it->height = getLineSpacing(*it);
+            top += it->height;
+        }
+
+        m_FullTextHeight = static_cast<float>(top);
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
+
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -972,47 +1062,194 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::updateDisplayedText()
+    void ChatBox::appendLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
     {
-        float position = 2.0f;
+        // Remove the top line if you exceed the maximum
+        if ((m_MaxLines > 0) && (m_MaxLines < m_Lines.size() + 1))
+        {
+            m_FullTextHeight -= m_Lines.front().height;
+            m_Lines.pop_front();
+        }
+
+        float width = m_Panel->getSize().x - 4.0f;
         if (m_Scroll)
-            position -= static_cast<float>(m_Scroll->getValue());
+            width -= m_Scroll->getSize().x;
 
-        sf::Text tempText("k", m_Panel->getGlobalFont(), 20);
+        Line line;
+        line.color = color;
+        line.textSize = textSize;
+        line.font = font;
+        line.text = wrapText(text, (font != nullptr) ? *font : m_Panel->getGlobalFont(), textSize, width, line.linesOfText);
 
-        auto& labels = m_Panel->getWidgets();
-        for (unsigned int i = 0; i < labels.size(); ++i)
-        {
-            tgui::Label::Ptr label = labels[i];
+        // The new line is placed directly below the previous one
+        line.top = m_Lines.empty() ? 0 : m_Lines.back().top + m_Lines.back().height;
+        line.height = getLineSpacing(line);
 
-            // Not every line has the same height
-            float positionFix = 0;
-            tempText.setCharacterSize(label->getTextSize());
-            if (tempText.getLocalBounds().height > label->getSize().y)
-                positionFix = tempText.getLocalBounds().height - label->getSize().y;
+        // Make sure the offsets can't overflow when lines keep being added and removed for a very long time
+        if (!m_Lines.empty() && (m_Lines.front().top > 0x40000000))
+        {
+            const unsigned int removedHeight = m_Lines.front().top;
+            for (auto it = m_Lines.begin(); it != m_Lines.end(); ++it)
+                it->top -= removedHeight;
 
-            label->setPosition(2.0f, position + positionFix);
-            position += getLineSpacing(i);
+            line.top -= removedHeight;
         }
 
-        // Correct the position when there is no scrollbar
-        if ((m_Scroll == nullptr) && (!labels.empty()))
+        m_Lines.push_back(line);
+        m_FullTextHeight += line.height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ChatBox::wrapText(const sf::String& text, const sf::Font& font, unsigned int textSize, float maxWidth, unsigned int& linesOfText)
+    {
+        std::basic_string<sf::Uint32> result;
+        result.reserve(text.getSize() + 8);
+
+        linesOfText = 1;
+
+        float lineWidth = 0;
+        std::size_t lineStart = 0;
+
+        // The last space on the current line and the width of the text behind it
+        std::size_t lastSpace = std::basic_string<sf::Uint32>::npos;
+        float widthAfterSpace = 0;
+
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < text.getSize(); ++i)
         {
-            tgui::Label::Ptr label = labels.back();
-            if (position > m_Panel->getSize().y)
+            const sf::Uint32 curChar = text[i];
+
+            // Newlines that were already in the text are kept
+            if (curChar == '\n')
+            {
+                result.push_back(curChar);
+                ++linesOfText;
+
+                lineWidth = 0;
+                lineStart = result.size();
+                lastSpace = std::basic_string<sf::Uint32>::npos;
+                prevChar = 0;
+                continue;
+            }
+
+            float charWidth = TGUI_TextMetrics.getAdvance(font, textSize, curChar);
+
+            float kerning = 0;
+            if (prevChar != 0)
+                kerning = TGUI_TextMetrics.getKerning(font, textSize, prevChar, curChar);
+
+            // Start a new line when the character no longer fits (but never leave an empty line behind)
+            if ((lineWidth + kerning + charWidth > maxWidth) && (result.size() > lineStart))
+            {
+                ++linesOfText;
+
+                if (curChar == ' ')
+                {
+                    // The space itself is replaced by the line break
+                    result.push_back('\n');
+
+                    lineWidth = 0;
+                    lineStart = result.size();
+                    lastSpace = std::basic_string<sf::Uint32>::npos;
+                    prevChar = 0;
+                    continue;
+                }
+                else if ((lastSpace != std::basic_string<sf::Uint32>::npos) && (widthAfterSpace + kerning + charWidth <= maxWidth))
+                {
+                    // Move the word that was being written to the next line
+                    result[lastSpace] = '\n';
+
+                    lineWidth = widthAfterSpace;
+                    lineStart = lastSpace + 1;
+                }
+                else // The word doesn't fit on a single line, so split it
+                {
+                    result.push_back('\n');
+
+                    lineWidth = 0;
+                    lineStart = result.size();
+                    kerning = 0;
+                }
+
+                lastSpace = std::basic_string<sf::Uint32>::npos;
+            }
+
+            result.push_back(curChar);
+            lineWidth += kerning + charWidth;
+
+            if (curChar == ' ')
             {
-                float diff = position - m_Panel->getSize().y;
-                for (auto it = labels.begin(); it != labels.end(); ++it)
-                    (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y - diff);
+                lastSpace = result.size() - 1;
+                widthAfterSpace = 0;
             }
+            else
+                widthAfterSpace += kerning + charWidth;
+
+            prevChar = curChar;
         }
 
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateScrollbarAfterAddingLines()
+    {
+        if (m_Scroll != nullptr)
+        {
+            m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
+
+            if (m_Scroll->getMaximum() > m_Scroll->getLowValue())
+                m_Scroll->setValue(m_Scroll->getMaximum() - m_Scroll->getLowValue());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateDisplayedText()
+    {
+        m_VisibleLines.clear();
+
+        if (m_Lines.empty())
+            return;
+
+        float position = 2.0f;
+        if (m_Scroll)
+            position -= static_cast<float>(m_Scroll->getValue());
+
+        // Correct the position when there is no scrollbar
+        if ((m_Scroll == nullptr) && (position + m_FullTextHeight > m_Panel->getSize().y))
+            position = m_Panel->getSize().y - m_FullTextHeight;
+
         // Put the lines at the bottom of the chat box if needed
-        if (m_LinesStartFromBottom && (position < m_Panel->getSize().y))
+        if (m_LinesStartFromBottom && (position + m_FullTextHeight < m_Panel->getSize().y))
+            position = m_Panel->getSize().y - m_FullTextHeight;
+
+        // The tops of the lines are not relative to the first line, so take that into account
+        position -= m_Lines.front().top;
+
+        // Find the first line that is still (partially) visible
+        auto it = std::upper_bound(m_Lines.cbegin(), m_Lines.cend(), -position,
+                                   [](float value, const Line& line) { return value < line.top + line.height; });
+
+        sf::Text tempText("k", m_Panel->getGlobalFont(), 20);
+        for (; (it != m_Lines.cend()) && (position + it->top < m_Panel->getSize().y); ++it)
         {
-            float diff = m_Panel->getSize().y - position;
-            for (auto it = labels.begin(); it != labels.end(); ++it)
-                (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y + diff);
+            sf::Text text(it->text, (it->font != nullptr) ? *it->font : m_Panel->getGlobalFont(), it->textSize);
+            text.setColor(it->color);
+
+            // Not every line has the same height
+            float positionFix = 0;
+            tempText.setFont(*text.getFont());
+            tempText.setCharacterSize(it->textSize);
+            if (tempText.getLocalBounds().height > text.getLocalBounds().height)
+                positionFix = tempText.getLocalBounds().height - text.getLocalBounds().height;
+
+            text.setPosition(std::floor(2.0f - text.getLocalBounds().left + 0.5f),
+                             std::floor(position + it->top + positionFix - text.getLocalBounds().top + 0.5f));
+
+            m_VisibleLines.push_back(text);
         }
     }
 
@@ -1020,34 +1257,41 @@ namespace tgui
 
     void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        // Draw the background of the panel
         m_Panel->setPosition(getAbsolutePosition());
-
-        // Draw the panel
         target.draw(*m_Panel);
 
         // Adjust the transformation
         states.transform *= getTransform();
 
+        // Draw the visible lines, but only inside the chat box
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Panel->getSize().x, m_Panel->getSize().y));
+
+        for (auto it = m_VisibleLines.cbegin(); it != m_VisibleLines.cend(); ++it)
+            TGUI_Renderer.draw(target, *it, states);
+
+        TGUI_Renderer.popClipping();
+
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Panel->getSize().y + m_TopBorder));
         border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Panel->getSize().x + m_RightBorder, static_cast<float>(m_TopBorder)));
         border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Panel->getSize().y + m_BottomBorder));
         border.setPosition(m_Panel->getSize().x, 0);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_Panel->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), m_Panel->getSize().y);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -50,6 +50,8 @@ namespace tgui
 
     bool Checkbox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -164,12 +166,14 @@ namespace tgui
 
     void Checkbox::check()
     {
+        invalidate();
+
         if (m_Checked == false)
         {
             m_Checked = true;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Checked].empty() == false)
+            if (isCallbackBound(Checked))
             {
                 m_Callback.trigger = Checked;
                 m_Callback.checked = true;
@@ -182,12 +186,14 @@ namespace tgui
 
     void Checkbox::uncheck()
     {
+        invalidate();
+
         if (m_Checked)
         {
             m_Checked = false;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Unchecked].empty() == false)
+            if (isCallbackBound(Unchecked))
             {
                 m_Callback.trigger = Unchecked;
                 m_Callback.checked = false;
@@ -201,7 +207,7 @@ namespace tgui
     void Checkbox::leftMouseReleased(float x, float y)
     {
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.checked = m_Checked;
@@ -220,7 +226,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.checked = m_Checked;
@@ -247,7 +253,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -263,7 +269,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Button.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChildWindow.hpp>
@@ -156,6 +154,8 @@ namespace tgui
 
     bool ChildWindow::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // Until the loading succeeds, the child window will be marked as unloaded
@@ -326,7 +326,7 @@ namespace tgui
                 m_Loaded = true;
                 setSize(width, width * 3.0f / 4.0f);
 
-                m_TextureTitleBar_M.data->texture.setRepeated(true);
+                m_TextureTitleBar_M.setRepeated(true);
             }
             else
             {
@@ -354,6 +354,9 @@ namespace tgui
         // Set the size of the title text
         m_TitleText.setCharacterSize(m_TitleBarHeight * 8 / 10);
 
+        // The widgets inside the child window are placed below the title bar
+        absolutePositionChanged();
+
         // When there is no error we will return true
         return true;
     }
@@ -369,6 +372,8 @@ namespace tgui
 
     void ChildWindow::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -389,7 +394,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -421,6 +426,8 @@ namespace tgui
 
     void ChildWindow::setBackgroundTexture(sf::Texture *const texture)
     {
+        invalidate();
+
         // Store the texture
         m_BackgroundTexture = texture;
 
@@ -443,6 +450,8 @@ namespace tgui
 
     void ChildWindow::setTitleBarHeight(unsigned int height)
     {
+        invalidateBounds();
+
         // Don't continue when the child window has not been loaded yet
         if (m_Loaded == false)
             return;
@@ -450,6 +459,9 @@ namespace tgui
         // Remember the new title bar height
         m_TitleBarHeight = height;
 
+        // The widgets inside the child window have moved
+        absolutePositionChanged();
+
         // Set the size of the close button
         m_CloseButton->setSize(static_cast<float>(height) / m_TextureTitleBar_M.getSize().y * m_CloseButton->m_TextureNormal_M.getSize().x,
                                static_cast<float>(height) / m_TextureTitleBar_M.getSize().y * m_CloseButton->m_TextureNormal_M.getSize().y);
@@ -470,7 +482,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -490,6 +502,8 @@ namespace tgui
 
     void ChildWindow::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -504,6 +518,8 @@ namespace tgui
 
     void ChildWindow::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Container::setTransparency(transparency);
 
         m_BackgroundSprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -521,6 +537,8 @@ namespace tgui
 
     void ChildWindow::setTitle(const sf::String& title)
     {
+        invalidate();
+
         m_TitleText.setString(title);
     }
 
@@ -535,6 +553,8 @@ namespace tgui
 
     void ChildWindow::setTitleColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TitleText.setColor(color);
     }
 
@@ -549,6 +569,8 @@ namespace tgui
 
     void ChildWindow::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -563,12 +585,17 @@ namespace tgui
 
     void ChildWindow::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidateBounds();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
 
+        // The widgets inside the child window have moved
+        absolutePositionChanged();
+
         // Recalculate the scale of the title bar images
         if (m_SplitImage)
         {
@@ -578,7 +605,7 @@ namespace tgui
             if (m_Size.x + m_LeftBorder + m_RightBorder < minimumWidth)
                 m_Size.x = minimumWidth - m_LeftBorder - m_RightBorder;
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -591,6 +618,8 @@ namespace tgui
 
     void ChildWindow::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidate();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -605,6 +634,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidate();
+
         m_TitleAlignment = alignment;
     }
 
@@ -619,6 +650,8 @@ namespace tgui
 
     void ChildWindow::setIcon(const std::string& filename)
     {
+        invalidate();
+
         // If a texture has already been loaded then remove it first
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
@@ -637,6 +670,8 @@ namespace tgui
 
     void ChildWindow::removeIcon()
     {
+        invalidate();
+
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
     }
@@ -645,7 +680,8 @@ namespace tgui
 
     void ChildWindow::destroy()
     {
-        m_Parent->remove(this);
+        if (m_Parent)
+            m_Parent->remove(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -673,24 +709,24 @@ namespace tgui
 
     void ChildWindow::setPosition(float x, float y)
     {
-        if (m_KeepInParent)
+        if (m_KeepInParent && m_Parent)
         {
             if (y < 0)
-                Transformable::setPosition(getPosition().x, 0);
+                Widget::setPosition(getPosition().x, 0);
             else if (y > m_Parent->getSize().y - m_TitleBarHeight)
-                Transformable::setPosition(getPosition().x, m_Parent->getSize().y - m_TitleBarHeight);
+                Widget::setPosition(getPosition().x, m_Parent->getSize().y - m_TitleBarHeight);
             else
-                Transformable::setPosition(getPosition().x, y);
+                Widget::setPosition(getPosition().x, y);
 
             if (x < 0)
-                Transformable::setPosition(0, getPosition().y);
+                Widget::setPosition(0, getPosition().y);
             else if (x > m_Parent->getSize().x - getSize().x)
-                Transformable::setPosition(m_Parent->getSize().x - getSize().x, getPosition().y);
+                Widget::setPosition(m_Parent->getSize().x - getSize().x, getPosition().y);
             else
-                Transformable::setPosition(x, getPosition().y);
+                Widget::setPosition(x, getPosition().y);
         }
         else
-            Transformable::setPosition(x, y);
+            Widget::setPosition(x, y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -704,9 +740,7 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
-
+            unhoverWidgets();
             return true;
         }
         else
@@ -721,8 +755,7 @@ namespace tgui
                     mouseLeftWidget();
 
                     // Tell the widgets inside the child window that the mouse is no longer on top of them
-                    for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                        m_Widgets[i]->mouseNotOnWidget();
+                    unhoverWidgets();
 
                     m_CloseButton->mouseNotOnWidget();
                     m_MouseHover = false;
@@ -743,7 +776,7 @@ namespace tgui
         m_Parent->moveWidgetToFront(this);
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -754,6 +787,9 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
+            // The close button may be pressed or released
+            invalidate();
+
             // Get the current position
             sf::Vector2f position = getPosition();
 
@@ -781,7 +817,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
+                invalidate();
                 m_CloseButton->mouseNotOnWidget();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -805,6 +844,9 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
+            // The close button may be pressed or released
+            invalidate();
+
             // Get the current position
             sf::Vector2f position = getPosition();
 
@@ -820,7 +862,7 @@ namespace tgui
                 if (m_CloseButton->mouseOnWidget(x, y))
                 {
                     // If a callback was requested then send it
-                    if (m_CallbackFunctions[Closed].empty() == false)
+                    if (isCallbackBound(Closed))
                     {
                         m_Callback.trigger = Closed;
                         addCallback();
@@ -845,7 +887,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
+                invalidate();
                 m_CloseButton->mouseNotOnWidget();
+            }
 
             m_CloseButton->mouseNoLongerDown();
 
@@ -879,7 +924,7 @@ namespace tgui
             setPosition(position.x + (x - position.x - m_DraggingPosition.x), position.y + (y - position.y - m_DraggingPosition.y));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Moved].empty() == false)
+            if (isCallbackBound(Moved))
             {
                 m_Callback.trigger = Moved;
                 m_Callback.position = getPosition();
@@ -896,10 +941,16 @@ namespace tgui
             // Temporary set the close button to the correct position
             m_CloseButton->setPosition(position.x + ((m_Size.x + m_LeftBorder + m_RightBorder - m_DistanceToSide - m_CloseButton->getSize().x)), position.y + ((m_TitleBarHeight / 2.f) - (m_CloseButton->getSize().x / 2.f)));
 
+            const bool closeButtonHovered = m_CloseButton->m_MouseHover;
+
             // Send the hover event to the close button
             if (m_CloseButton->mouseOnWidget(x, y))
                 m_CloseButton->mouseMoved(x, y);
 
+            // The close button looks different while the mouse is on top of it
+            if (m_CloseButton->m_MouseHover != closeButtonHovered)
+                invalidate();
+
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
             return;
@@ -908,7 +959,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
+                invalidate();
                 m_CloseButton->mouseNotOnWidget();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -1052,11 +1106,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(Closed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Closed).size() == 1) && (m_CallbackFunctions.at(Closed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Closed))
                 callbacks.push_back("Closed");
-            if ((m_CallbackFunctions.find(Moved) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Moved).size() == 1) && (m_CallbackFunctions.at(Moved).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Moved))
                 callbacks.push_back("Moved");
 
             encodeList(callbacks, value);
@@ -1107,30 +1161,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPanelPosition = sf::Vector2f(((getAbsolutePosition().x + m_LeftBorder - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                         ((getAbsolutePosition().y + m_TitleBarHeight + m_TopBorder - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPanelPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x + m_LeftBorder - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                             (getAbsolutePosition().y + m_TitleBarHeight + m_Size.y + m_TopBorder - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-        sf::Vector2f topLeftTitleBarPosition;
-        sf::Vector2f bottomRightTitleBarPosition;
-
-        if (m_IconTexture.data)
-            topLeftTitleBarPosition = sf::Vector2f(((getAbsolutePosition().x + 2*m_DistanceToSide + m_IconTexture.getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                   ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        else
-            topLeftTitleBarPosition = sf::Vector2f(((getAbsolutePosition().x + m_DistanceToSide - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                   ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-
-        bottomRightTitleBarPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x + m_LeftBorder + m_RightBorder - (2*m_DistanceToSide) - m_CloseButton->getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                   (getAbsolutePosition().y + m_TitleBarHeight - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -1139,19 +1169,19 @@ namespace tgui
         // Check if the title bar image is split
         if (m_SplitImage)
         {
-            target.draw(m_TextureTitleBar_L, states);
+            TGUI_Renderer.draw(target, m_TextureTitleBar_L, states);
 
             states.transform.translate(m_TextureTitleBar_L.getSize().x * (static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y), 0);
-            target.draw(m_TextureTitleBar_M, states);
+            TGUI_Renderer.draw(target, m_TextureTitleBar_M, states);
 
             states.transform.translate(m_Size.x + m_LeftBorder + m_RightBorder - ((m_TextureTitleBar_R.getSize().x + m_TextureTitleBar_L.getSize().x)
                                                                                   * (static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y)), 0);
-            target.draw(m_TextureTitleBar_R, states);
+            TGUI_Renderer.draw(target, m_TextureTitleBar_R, states);
         }
         else // The title bar image isn't split
         {
             // Draw the title bar
-            target.draw(m_TextureTitleBar_M, states);
+            TGUI_Renderer.draw(target, m_TextureTitleBar_M, states);
         }
 
         states.transform = oldTransform;
@@ -1160,31 +1190,21 @@ namespace tgui
         if (m_IconTexture.data)
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / 2.f);
-            target.draw(m_IconTexture, states);
+            TGUI_Renderer.draw(target, m_IconTexture, states);
             states.transform.translate(m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x, (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / -2.f);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
         // Check if there is a title
         if (m_TitleText.getString().isEmpty() == false)
         {
-            // Calculate the clipping area
-            GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+            // Only allow drawing the title between the icon and the close button
+            float titleLeft = getAbsolutePosition().x + m_DistanceToSide;
+            if (m_IconTexture.data)
+                titleLeft += m_DistanceToSide + m_IconTexture.getSize().x;
 
-            // If the widget outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
+            float titleRight = getAbsolutePosition().x + m_Size.x + m_LeftBorder + m_RightBorder - (2*m_DistanceToSide) - m_CloseButton->getSize().x;
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            TGUI_Renderer.pushClipping(target, sf::FloatRect(titleLeft, getAbsolutePosition().y, titleRight - titleLeft, static_cast<float>(m_TitleBarHeight)));
 
             // Center the text vertically
             states.transform.translate(0, std::floor(((m_TitleBarHeight - m_TitleText.getLocalBounds().height) / 2.0f) - m_TitleText.getLocalBounds().top));
@@ -1193,7 +1213,7 @@ namespace tgui
             if (m_TitleAlignment == TitleAlignmentLeft)
             {
                 states.transform.translate(std::floor(static_cast<float>(m_DistanceToSide) + 0.5f), 0);
-                target.draw(m_TitleText, states);
+                TGUI_Renderer.draw(target, m_TitleText, states);
             }
             else if (m_TitleAlignment == TitleAlignmentCentered)
             {
@@ -1202,7 +1222,7 @@ namespace tgui
                 else
                     states.transform.translate(std::floor(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 3*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width) / 2.0f) + 0.5f), 0);
 
-                target.draw(m_TitleText, states);
+                TGUI_Renderer.draw(target, m_TitleText, states);
             }
             else // if (m_TitleAlignment == TitleAlignmentRight)
             {
@@ -1211,11 +1231,11 @@ namespace tgui
                 else
                     states.transform.translate(std::floor((m_Size.x + m_LeftBorder + m_RightBorder) - 2*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width + 0.5f), 0);
 
-                target.draw(m_TitleText, states);
+                TGUI_Renderer.draw(target, m_TitleText, states);
             }
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            TGUI_Renderer.popClipping();
         }
 
         // Move the close button to the correct position
@@ -1231,21 +1251,21 @@ namespace tgui
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Size.y + m_TopBorder));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Size.x + m_RightBorder, static_cast<float>(m_TopBorder)));
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Size.y + m_BottomBorder));
         border.setPosition(m_Size.x + m_LeftBorder, 0);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_Size.x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(0, m_Size.y + m_TopBorder);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Make room for the borders
         states.transform.translate(static_cast<float>(m_LeftBorder), static_cast<float>(m_TopBorder));
@@ -1255,33 +1275,21 @@ namespace tgui
         {
             sf::RectangleShape background(sf::Vector2f(m_Size.x, m_Size.y));
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            TGUI_Renderer.draw(target, background, states);
         }
 
         // Draw the background image if there is one
         if (m_BackgroundTexture != nullptr)
-            target.draw(m_BackgroundSprite, states);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+            TGUI_Renderer.draw(target, m_BackgroundSprite, states);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Only allow drawing the widgets inside the child window
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x + m_LeftBorder, getAbsolutePosition().y + m_TitleBarHeight + m_TopBorder, m_Size.x, m_Size.y));
 
         // Draw the widgets in the child window
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +78,8 @@ namespace tgui
 
     void ClickableWidget::setSize(float width, float height)
     {
+        invalidateBounds();
+
         m_Size.x = width;
         m_Size.y = height;
     }
@@ -110,11 +112,13 @@ namespace tgui
 
     void ClickableWidget::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Set the mouse down flag
         m_MouseDown = true;
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -127,8 +131,10 @@ namespace tgui
 
     void ClickableWidget::leftMouseReleased(float x, float y)
     {
+        invalidate();
+
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -140,7 +146,7 @@ namespace tgui
         if (m_MouseDown == true)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -195,11 +201,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMouseReleased))
                 callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMouseClicked))
                 callbacks.push_back("LeftMouseClicked");
 
             encodeList(callbacks, value);
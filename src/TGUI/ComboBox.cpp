@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/ListBox.hpp>
 #include <TGUI/Container.hpp>
@@ -120,6 +118,8 @@ namespace tgui
 
     bool ComboBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -270,6 +270,8 @@ namespace tgui
 
     void ComboBox::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't set the scale when loading failed
         if (m_Loaded == false)
             return;
@@ -308,8 +310,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect ComboBox::getBounds() const
+    {
+        // The borders are drawn outside the combo box
+        return sf::FloatRect(getPosition().x - m_LeftBorder, getPosition().y - m_TopBorder, getFullSize().x, getFullSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setItemsToDisplay(unsigned int nrOfItemsInList)
     {
+        invalidate();
+
         m_NrOfItemsToDisplay = nrOfItemsInList;
 
         if (m_NrOfItemsToDisplay < m_ListBox->m_Items.size())
@@ -329,6 +341,8 @@ namespace tgui
                                 const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor,
                                 const sf::Color& borderColor)
     {
+        invalidate();
+
         m_ListBox->changeColors(backgroundColor, textColor, selectedBackgroundColor, selectedTextColor, borderColor);
     }
 
@@ -336,6 +350,8 @@ namespace tgui
 
     void ComboBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_ListBox->setBackgroundColor(backgroundColor);
     }
 
@@ -343,6 +359,8 @@ namespace tgui
 
     void ComboBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_ListBox->setTextColor(textColor);
     }
 
@@ -350,6 +368,8 @@ namespace tgui
 
     void ComboBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_ListBox->setSelectedBackgroundColor(selectedBackgroundColor);
     }
 
@@ -357,6 +377,8 @@ namespace tgui
 
     void ComboBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_ListBox->setSelectedTextColor(selectedTextColor);
     }
 
@@ -364,6 +386,8 @@ namespace tgui
 
     void ComboBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_ListBox->setBorderColor(borderColor);
     }
 
@@ -406,6 +430,8 @@ namespace tgui
 
     void ComboBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_ListBox->setTextFont(font);
     }
 
@@ -420,6 +446,8 @@ namespace tgui
 
     void ComboBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidateBounds();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -440,6 +468,8 @@ namespace tgui
 
     int ComboBox::addItem(const sf::String& item, int id)
     {
+        invalidate();
+
         // An item can only be added when the combo box was loaded correctly
         if (m_Loaded == false)
             return false;
@@ -456,6 +486,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         return m_ListBox->setSelectedItem(itemName);
     }
 
@@ -463,6 +495,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(int index)
     {
+        invalidate();
+
         return m_ListBox->setSelectedItem(index);
     }
 
@@ -470,6 +504,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidate();
+
         m_ListBox->deselectItem();
     }
 
@@ -477,6 +513,8 @@ namespace tgui
 
     bool ComboBox::removeItem(unsigned int index)
     {
+        invalidate();
+
         bool ret = m_ListBox->removeItem(index);
 
         // Shrink the list size
@@ -490,6 +528,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         bool ret = m_ListBox->removeItem(itemName);
 
         // Shrink the list size
@@ -503,6 +543,8 @@ namespace tgui
 
     unsigned int ComboBox::removeItemsById(int id)
     {
+        invalidate();
+
         unsigned int ret = m_ListBox->removeItemsById(id);
 
         // Shrink the list size
@@ -516,6 +558,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
+        invalidate();
+
         m_ListBox->removeAllItems();
         m_ListBox->setSize(m_ListBox->getSize().x, m_ListBox->getItemHeight());
     }
@@ -566,6 +610,8 @@ namespace tgui
 
     bool ComboBox::changeItem(unsigned int index, const sf::String& newValue)
     {
+        invalidate();
+
         return m_ListBox->changeItem(index, newValue);
     }
 
@@ -573,6 +619,8 @@ namespace tgui
 
     unsigned int ComboBox::changeItems(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         return m_ListBox->changeItems(originalValue, newValue);
     }
 
@@ -580,6 +628,8 @@ namespace tgui
 
     unsigned int ComboBox::changeItemsById(int id, const sf::String& newValue)
     {
+        invalidate();
+
         return m_ListBox->changeItemsById(id, newValue);
     }
 
@@ -587,6 +637,8 @@ namespace tgui
 
     bool ComboBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         return m_ListBox->setScrollbar(scrollbarConfigFileFilename);
     }
 
@@ -594,6 +646,8 @@ namespace tgui
 
     void ComboBox::removeScrollbar()
     {
+        invalidate();
+
         m_ListBox->removeScrollbar();
     }
 
@@ -601,6 +655,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(unsigned int maximumItems)
     {
+        invalidate();
+
         m_ListBox->setMaximumItems(maximumItems);
     }
 
@@ -615,6 +671,8 @@ namespace tgui
 
     void ComboBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_ListBox->setTransparency(m_Opacity);
@@ -655,6 +713,8 @@ namespace tgui
 
     void ComboBox::leftMousePressed(float, float)
     {
+        invalidate();
+
         m_MouseDown = true;
 
         // If the list wasn't visible then open it
@@ -691,6 +751,8 @@ namespace tgui
 
     void ComboBox::mouseWheelMoved(int delta, int, int)
     {
+        invalidate();
+
         // The list isn't visible
         if (!m_ListBox->isVisible())
         {
@@ -834,7 +896,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ItemSelected))
                 callbacks.push_back("ItemSelected");
 
             encodeList(callbacks, value);
@@ -882,6 +944,8 @@ namespace tgui
 
     void ComboBox::showListBox()
     {
+        invalidate();
+
         if (!m_ListBox->isVisible())
         {
             m_ListBox->show();
@@ -913,6 +977,8 @@ namespace tgui
 
     void ComboBox::hideListBox()
     {
+        invalidate();
+
         // If the list was open then close it now
         if (m_ListBox->isVisible())
         {
@@ -931,7 +997,7 @@ namespace tgui
 
     void ComboBox::newItemSelectedCallbackFunction()
     {
-        if (m_CallbackFunctions[ItemSelected].empty() == false)
+        if (isCallbackBound(ItemSelected))
         {
             // When no item is selected then send an empty string, otherwise send the item
             m_Callback.text    = m_ListBox->getSelectedItem();
@@ -959,19 +1025,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + (m_ListBox->getSize().x - (m_TextureArrowDownNormal.getSize().x * (static_cast<float>(m_ListBox->getItemHeight()) / m_TextureArrowDownNormal.getSize().y)))
-                                                         - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_ListBox->getSize().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -982,60 +1035,46 @@ namespace tgui
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
         border.setFillColor(m_ListBox->m_BorderColor);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x + m_RightBorder), static_cast<float>(m_TopBorder)));
         border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_ListBox->getItemHeight() + m_BottomBorder)));
         border.setPosition(static_cast<float>(m_ListBox->getSize().x), 0);
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_ListBox->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight()));
-        target.draw(border, states);
+        TGUI_Renderer.draw(target, border, states);
 
         // Draw the combo box
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x),
                                               static_cast<float>(m_ListBox->getItemHeight())));
         front.setFillColor(m_ListBox->getBackgroundColor());
-        target.draw(front, states);
+        TGUI_Renderer.draw(target, front, states);
 
         // Create a text widget to draw it
         sf::Text tempText("kg", *m_ListBox->getTextFont());
         tempText.setCharacterSize(static_cast<unsigned int>(m_ListBox->getItemHeight() * 0.8f));
         tempText.setColor(m_ListBox->getTextColor());
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x  * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Don't draw the selected item on top of the arrow
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y,
+                                                          m_ListBox->getSize().x - (m_TextureArrowDownNormal.getSize().x * (static_cast<float>(m_ListBox->getItemHeight()) / m_TextureArrowDownNormal.getSize().y)),
+                                                          static_cast<float>(m_ListBox->getSize().y)));
 
         // Draw the selected item
         states.transform.translate(2, std::floor((static_cast<int>(m_ListBox->getItemHeight()) - tempText.getLocalBounds().height) / 2.0f -  tempText.getLocalBounds().top));
         tempText.setString(m_ListBox->getSelectedItem());
-        target.draw(tempText, states);
+        TGUI_Renderer.draw(target, tempText, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
 
         // Reset the transformations
         states.transform = oldTransform;
@@ -1051,16 +1090,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
             }
         }
         else
@@ -1073,16 +1112,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
             }
         }
     }
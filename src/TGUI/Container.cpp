@@ -25,6 +25,7 @@
 
 #include <stack>
 #include <cmath>
+#include <algorithm>
 #include <cassert>
 
 #include <TGUI/TGUI.hpp>
@@ -35,21 +36,61 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Container::NameKey::NameKey(const sf::String& widgetName) :
+        name(widgetName),
+        hash(hashName(widgetName))
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::NameKey::hashName(const sf::String& widgetName)
+    {
+        // FNV-1a hash over the characters of the name
+        std::size_t hash = 2166136261u;
+        for (auto it = widgetName.begin(); it != widgetName.end(); ++it)
+        {
+            hash ^= *it;
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container() :
-        m_FocusedWidget(0)
+        m_FocusedWidget           (0),
+        m_HoveredWidget           (nullptr),
+        m_CapturedWidget          (nullptr),
+        m_RenderCaching           (false),
+        m_RenderCacheNeedsUpdate  (true),
+        m_RenderCache             (nullptr),
+        m_SpatialIndexing         (false),
+        m_SpatialIndexCellSize    (64),
+        m_SpatialIndexNeedsRebuild(true),
+        m_NameIndexNeedsRebuild   (true)
     {
         m_ContainerWidget = true;
-        m_AnimatedWidget = true;
         m_AllowFocus = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& containerToCopy) :
-        Widget                   (containerToCopy),
-        m_FocusedWidget          (0),
-        m_GlobalFont             (containerToCopy.m_GlobalFont),
-        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions)
+        Widget                    (containerToCopy),
+        m_FocusedWidget           (0),
+        m_HoveredWidget           (nullptr),
+        m_CapturedWidget          (nullptr),
+        m_GlobalFont              (containerToCopy.m_GlobalFont),
+        m_GlobalCallbackFunctions (containerToCopy.m_GlobalCallbackFunctions),
+        m_RenderCaching           (containerToCopy.m_RenderCaching),
+        m_RenderCacheNeedsUpdate  (true),
+        m_RenderCache             (nullptr),
+        m_SpatialIndexing         (containerToCopy.m_SpatialIndexing),
+        m_SpatialIndexCellSize    (containerToCopy.m_SpatialIndexCellSize),
+        m_SpatialIndexNeedsRebuild(true),
+        m_NameIndexNeedsRebuild   (true)
     {
         // Copy all the widgets
         for (unsigned int i = 0; i < containerToCopy.m_Widgets.size(); ++i)
@@ -66,6 +107,11 @@ namespace tgui
     Container::~Container()
     {
         removeAllWidgets();
+
+        // A font that is created later at the same address must not use the measurements of this font
+        TGUI_TextMetrics.removeFont(m_GlobalFont);
+
+        delete m_RenderCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,8 +125,13 @@ namespace tgui
 
             // Copy the font and the callback functions
             m_FocusedWidget = 0;
+            TGUI_TextMetrics.removeFont(m_GlobalFont);
             m_GlobalFont = right.m_GlobalFont;
             m_GlobalCallbackFunctions = right.m_GlobalCallbackFunctions;
+            m_RenderCaching = right.m_RenderCaching;
+            m_RenderCacheNeedsUpdate = true;
+            m_SpatialIndexing = right.m_SpatialIndexing;
+            m_SpatialIndexCellSize = right.m_SpatialIndexCellSize;
 
             // Remove all the old widgets
             removeAllWidgets();
@@ -92,7 +143,10 @@ namespace tgui
                 m_ObjName.push_back(right.m_ObjName[i]);
 
                 m_Widgets.back()->m_Parent = this;
+                registerScheduledUpdates(m_Widgets.back().get());
             }
+
+            widgetNamesChanged();
         }
 
         return *this;
@@ -102,6 +156,10 @@ namespace tgui
 
     bool Container::setGlobalFont(const std::string& filename)
     {
+        invalidate();
+
+        // The measurements of the old font can't be used for the new one
+        TGUI_TextMetrics.removeFont(m_GlobalFont);
         return m_GlobalFont.loadFromFile(getResourcePath() + filename);
     }
 
@@ -109,7 +167,10 @@ namespace tgui
 
     void Container::setGlobalFont(const sf::Font& font)
     {
+        // The measurements of the old font can't be used for the new one
+        TGUI_TextMetrics.removeFont(m_GlobalFont);
         m_GlobalFont = font;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +191,9 @@ namespace tgui
 
     std::vector<sf::String>& Container::getWidgetNames()
     {
+        // The names can be changed through the returned reference
+        widgetNamesChanged();
+
         return m_ObjName;
     }
 
@@ -140,29 +204,26 @@ namespace tgui
         assert(widgetPtr != nullptr);
 
         widgetPtr->initialize(this);
+        widgetPtr->absolutePositionChanged();
+        registerScheduledUpdates(widgetPtr.get());
         m_Widgets.push_back(widgetPtr);
         m_ObjName.push_back(widgetName);
+        widgetNamesChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName, bool recursive) const
     {
-        for (unsigned int i = 0; i < m_ObjName.size(); ++i)
-        {
-            if (m_ObjName[i] == widgetName)
-            {
-                return m_Widgets[i];
-            }
-            else if (recursive && m_Widgets[i]->m_ContainerWidget)
-            {
-                Widget::Ptr widget = Container::Ptr(m_Widgets[i])->get(widgetName, true);
-                if (widget != nullptr)
-                    return widget;
-            }
-        }
+        return getWidgetByName(widgetName, NameKey::hashName(widgetName), recursive);
+    }
 
-        return nullptr;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::get(const NameKey& widgetKey, bool recursive) const
+    {
+        return getWidgetByName(widgetKey.name, widgetKey.hash, recursive);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +233,9 @@ namespace tgui
         Widget::Ptr newWidget = oldWidget.clone();
         m_Widgets.push_back(newWidget);
         m_ObjName.push_back(newWidgetName);
+        registerScheduledUpdates(newWidget.get());
+        widgetNamesChanged();
+        invalidate();
         return newWidget;
     }
 
@@ -200,12 +264,27 @@ namespace tgui
                 if (m_FocusedWidget > i+1)
                     m_FocusedWidget--;
 
+                // Forget that the mouse was on top of the widget or went down on it
+                if (m_HoveredWidget == m_Widgets[i])
+                    m_HoveredWidget = nullptr;
+                if (m_CapturedWidget == m_Widgets[i])
+                    m_CapturedWidget = nullptr;
+
+                // The widget no longer belongs to the gui
+                unregisterScheduledUpdates(m_Widgets[i].get());
+                m_Widgets[i]->m_Parent = nullptr;
+
                 // Remove the widget
                 m_Widgets.erase(m_Widgets.begin() + i);
 
                 // Also emove the name it from the list
                 m_ObjName.erase(m_ObjName.begin() + i);
 
+                // The indices of the widgets behind it have changed
+                m_SpatialIndexNeedsRebuild = true;
+                widgetNamesChanged();
+
+                invalidate();
                 break;
             }
         }
@@ -215,12 +294,29 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        // The widget that was focused has to know that it lost its focus
+        unfocusWidgets();
+
+        // The widgets no longer belong to the gui
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            unregisterScheduledUpdates(m_Widgets[i].get());
+            m_Widgets[i]->m_Parent = nullptr;
+        }
+
         // Clear the lists
         m_Widgets.clear();
         m_ObjName.clear();
+        m_HoveredWidget = nullptr;
+        m_CapturedWidget = nullptr;
 
         // There are no more widgets, so none of the widgets can be focused
         m_FocusedWidget = 0;
+
+        m_SpatialIndexNeedsRebuild = true;
+        widgetNamesChanged();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +328,7 @@ namespace tgui
             if (m_Widgets[i] == widget)
             {
                 m_ObjName[i] = name;
+                widgetNamesChanged();
                 return true;
             }
         }
@@ -419,6 +516,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::unhoverWidgets()
+    {
+        if (m_HoveredWidget != nullptr)
+        {
+            m_HoveredWidget->mouseNotOnWidget();
+            m_HoveredWidget = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::uncheckRadioButtons()
     {
         // Loop through all radio buttons and uncheck them
@@ -453,6 +561,10 @@ namespace tgui
                 m_Widgets.erase(m_Widgets.begin() + i);
                 m_ObjName.erase(m_ObjName.begin() + i);
 
+                m_SpatialIndexNeedsRebuild = true;
+                widgetNamesChanged();
+
+                invalidate();
                 break;
             }
         }
@@ -484,6 +596,10 @@ namespace tgui
                 m_Widgets.erase(m_Widgets.begin() + i + 1);
                 m_ObjName.erase(m_ObjName.begin() + i + 1);
 
+                m_SpatialIndexNeedsRebuild = true;
+                widgetNamesChanged();
+
+                invalidate();
                 break;
             }
         }
@@ -848,6 +964,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCaching(bool cacheRendering)
+    {
+        m_RenderCaching = cacheRendering;
+
+        // Free the texture when it is no longer used
+        if (!m_RenderCaching)
+        {
+            delete m_RenderCache;
+            m_RenderCache = nullptr;
+        }
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getRenderCaching() const
+    {
+        return m_RenderCaching;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexing(bool useSpatialIndex, float cellSize)
+    {
+        m_SpatialIndexing = useSpatialIndex;
+        m_SpatialIndexCellSize = cellSize;
+
+        // The index is built again when it is needed
+        m_SpatialIndexNeedsRebuild = true;
+        m_SpatialIndexCells.clear();
+        m_SpatialIndexWidgetCells.clear();
+        m_SpatialIndexWidgetIds.clear();
+        m_SpatialIndexChangedWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getSpatialIndexing() const
+    {
+        return m_SpatialIndexing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidate()
+    {
+        m_RenderCacheNeedsUpdate = true;
+        Widget::invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::addChildCallback(const Callback& callback)
     {
         // If there is no global callback function then send the callback to the parent
@@ -947,9 +1116,7 @@ namespace tgui
         if (m_MouseHover == true)
         {
             mouseLeftWidget();
-
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            unhoverWidgets();
 
             m_MouseHover = false;
         }
@@ -982,21 +1149,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::update()
+    void Container::absolutePositionChanged()
     {
-        // Loop through all widgets
+        Widget::absolutePositionChanged();
+
+        // When the position of a child is already outdated then the positions of its children are outdated as well
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
-            // Check if the widget is a container or a widget that uses the time
-            if (m_Widgets[i]->m_AnimatedWidget)
-            {
-                // Update the elapsed time
-                m_Widgets[i]->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
-                m_Widgets[i]->update();
-            }
+            if (!m_Widgets[i]->m_AbsolutePositionNeedsUpdate)
+                m_Widgets[i]->absolutePositionChanged();
         }
-
-        m_AnimationTimeElapsed = sf::Time();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1006,19 +1168,18 @@ namespace tgui
         // Check if a mouse button has moved
         if (event.type == sf::Event::MouseMoved)
         {
-            // Loop through all widgets
-            for (unsigned int i=0; i<m_Widgets.size(); ++i)
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            if ((m_CapturedWidget != nullptr) && (m_CapturedWidget->m_MouseDown))
             {
-                // Check if the mouse went down on the widget
-                if (m_Widgets[i]->m_MouseDown)
+                // The dragged widget is the only one that can be below the mouse
+                if (m_HoveredWidget != m_CapturedWidget)
                 {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((m_Widgets[i]->m_DraggableWidget) || (m_Widgets[i]->m_ContainerWidget))
-                    {
-                        m_Widgets[i]->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
-                        return true;
-                    }
+                    unhoverWidgets();
+                    m_HoveredWidget = m_CapturedWidget;
                 }
+
+                m_CapturedWidget->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+                return true;
             }
 
             // Check if the mouse is on top of a widget
@@ -1059,6 +1220,13 @@ namespace tgui
                     }
 
                     widget->leftMousePressed(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+
+                    // Widgets that can be dragged receive the mouse move events until the mouse is released
+                    if ((widget->m_DraggableWidget) || (widget->m_ContainerWidget))
+                        m_CapturedWidget = widget;
+                    else
+                        m_CapturedWidget = nullptr;
+
                     return true;
                 }
                 else // The mouse didn't went down on a widget, so unfocus the focused widget
@@ -1086,6 +1254,8 @@ namespace tgui
                         (*it)->mouseNoLongerDown();
                 }
 
+                m_CapturedWidget = nullptr;
+
                 if (widget != nullptr)
                     return true;
             }
@@ -1282,47 +1452,424 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
     {
-        bool widgetFound = false;
         Widget::Ptr widget = nullptr;
 
-        // Loop through all widgets
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
+        if (m_SpatialIndexing)
         {
-            // Check if the widget is visible and enabled
-            if (((*it)->m_Visible) && ((*it)->m_Enabled))
+            updateSpatialIndex();
+
+            // Only the widgets that overlap with the cell below the mouse have to be checked
+            auto cell = m_SpatialIndexCells.find(std::make_pair(static_cast<int>(std::floor(x / m_SpatialIndexCellSize)),
+                                                                static_cast<int>(std::floor(y / m_SpatialIndexCellSize))));
+            if (cell != m_SpatialIndexCells.end())
             {
-                if (widgetFound == false)
+                // The indices in a cell are sorted, so the widgets that lie on top are checked first by looping backwards
+                for (auto it = cell->second.rbegin(); it != cell->second.rend(); ++it)
+                {
+                    Widget::Ptr& candidate = m_Widgets[*it];
+                    if ((candidate->m_Visible) && (candidate->m_Enabled) && (candidate->mouseOnWidget(x, y)))
+                    {
+                        widget = candidate;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Loop through all widgets, starting with the one on top
+            for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
+            {
+                // Check if the widget is visible and enabled
+                if (((*it)->m_Visible) && ((*it)->m_Enabled))
                 {
                     // Return the widget if the mouse is on top of it
                     if ((*it)->mouseOnWidget(x, y))
                     {
                         widget = *it;
-                        widgetFound = true;
+                        break;
                     }
                 }
-                else // The widget was already found, so tell the other widgets that the mouse can't be on them
-                    (*it)->mouseNotOnWidget();
             }
         }
 
+        // Only the widget that the mouse was on before has to be told that the mouse is no longer on top of it
+        if (m_HoveredWidget != widget)
+        {
+            unhoverWidgets();
+            m_HoveredWidget = widget;
+        }
+
+        return widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetChanged(const Widget* widget)
+    {
+        if (!m_SpatialIndexing || m_SpatialIndexNeedsRebuild)
+            return;
+
+        // When a lot of widgets change at once then it is faster to just rebuild the whole index
+        if (m_SpatialIndexChangedWidgets.size() >= m_Widgets.size())
+        {
+            m_SpatialIndexNeedsRebuild = true;
+            m_SpatialIndexChangedWidgets.clear();
+        }
+        else
+            m_SpatialIndexChangedWidgets.insert(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateSpatialIndex()
+    {
+        // The widget list may also have been changed through getWidgets
+        if (m_SpatialIndexWidgetCells.size() > m_Widgets.size())
+            m_SpatialIndexNeedsRebuild = true;
+
+        if (m_SpatialIndexNeedsRebuild)
+        {
+            m_SpatialIndexCells.clear();
+            m_SpatialIndexWidgetCells.clear();
+            m_SpatialIndexWidgetIds.clear();
+            m_SpatialIndexChangedWidgets.clear();
+            m_SpatialIndexNeedsRebuild = false;
+        }
+        else
+        {
+            // Move the widgets that changed to the cells that they cover now
+            for (auto it = m_SpatialIndexChangedWidgets.begin(); it != m_SpatialIndexChangedWidgets.end(); ++it)
+            {
+                auto id = m_SpatialIndexWidgetIds.find(*it);
+                if (id != m_SpatialIndexWidgetIds.end())
+                {
+                    removeFromSpatialIndex(id->second);
+                    addToSpatialIndex(id->second);
+                }
+            }
+
+            m_SpatialIndexChangedWidgets.clear();
+        }
+
+        // Add the widgets that aren't in the index yet
+        for (unsigned int i = m_SpatialIndexWidgetCells.size(); i < m_Widgets.size(); ++i)
+        {
+            m_SpatialIndexWidgetCells.push_back(sf::IntRect());
+            m_SpatialIndexWidgetIds[m_Widgets[i].get()] = i;
+            addToSpatialIndex(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToSpatialIndex(unsigned int index)
+    {
+        sf::FloatRect bounds = m_Widgets[index]->getBounds();
+
+        // Find out which cells are covered by the widget
+        sf::IntRect& cells = m_SpatialIndexWidgetCells[index];
+        cells.left = static_cast<int>(std::floor(bounds.left / m_SpatialIndexCellSize));
+        cells.top = static_cast<int>(std::floor(bounds.top / m_SpatialIndexCellSize));
+        cells.width = static_cast<int>(std::floor((bounds.left + bounds.width) / m_SpatialIndexCellSize)) - cells.left + 1;
+        cells.height = static_cast<int>(std::floor((bounds.top + bounds.height) / m_SpatialIndexCellSize)) - cells.top + 1;
+
+        for (int x = cells.left; x < cells.left + cells.width; ++x)
+        {
+            for (int y = cells.top; y < cells.top + cells.height; ++y)
+            {
+                // Keep the indices sorted so that the hit test can find the top widget without sorting them
+                std::vector<unsigned int>& cell = m_SpatialIndexCells[std::make_pair(x, y)];
+                cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromSpatialIndex(unsigned int index)
+    {
+        const sf::IntRect& cells = m_SpatialIndexWidgetCells[index];
+        for (int x = cells.left; x < cells.left + cells.width; ++x)
+        {
+            for (int y = cells.top; y < cells.top + cells.height; ++y)
+            {
+                auto cell = m_SpatialIndexCells.find(std::make_pair(x, y));
+                if (cell != m_SpatialIndexCells.end())
+                {
+                    cell->second.erase(std::remove(cell->second.begin(), cell->second.end(), index), cell->second.end());
+                    if (cell->second.empty())
+                        m_SpatialIndexCells.erase(cell);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getWidgetByName(const sf::String& widgetName, std::size_t hash, bool recursive) const
+    {
+        if (!recursive)
+            return findWidgetByName(widgetName, hash, false);
+
+        // Check if the widget was already found before
+        auto cached = m_RecursiveNameCache.find(hash);
+        if (cached != m_RecursiveNameCache.end())
+        {
+            for (auto it = cached->second.begin(); it != cached->second.end(); ++it)
+            {
+                if (it->first == widgetName)
+                    return it->second;
+            }
+        }
+
+        // Search the widget and remember where it was found (only the widgets that exist are cached)
+        Widget::Ptr widget = findWidgetByName(widgetName, hash, true);
+        if (widget != nullptr)
+            m_RecursiveNameCache[hash].push_back(std::make_pair(widgetName, widget));
+
         return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::findWidgetByName(const sf::String& widgetName, std::size_t hash, bool recursive) const
+    {
+        updateNameIndex();
+
+        // Find the first widget in this container with the given name
+        unsigned int index = m_Widgets.size();
+        auto bucket = m_NameIndex.find(hash);
+        if (bucket != m_NameIndex.end())
+        {
+            for (auto it = bucket->second.begin(); it != bucket->second.end(); ++it)
+            {
+                if (m_ObjName[*it] == widgetName)
+                {
+                    index = *it;
+                    break;
+                }
+            }
+        }
+
+        // The child containers in front of that widget are searched first
+        if (recursive)
+        {
+            for (auto it = m_NameIndexContainers.begin(); (it != m_NameIndexContainers.end()) && (*it < index); ++it)
+            {
+                Widget::Ptr widget = static_cast<Container*>(m_Widgets[*it].get())->findWidgetByName(widgetName, hash, true);
+                if (widget != nullptr)
+                    return widget;
+            }
+        }
+
+        if (index < m_Widgets.size())
+            return m_Widgets[index];
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetNamesChanged()
+    {
+        m_NameIndexNeedsRebuild = true;
+
+        // The widgets that were found by recursive lookups may no longer be the correct ones
+        for (Container* container = this; container != nullptr; container = container->m_Parent)
+            container->m_RecursiveNameCache.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndex() const
+    {
+        if (!m_NameIndexNeedsRebuild)
+            return;
+
+        m_NameIndex.clear();
+        m_NameIndexContainers.clear();
+
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            m_NameIndex[NameKey::hashName(m_ObjName[i])].push_back(i);
+
+            if (m_Widgets[i]->m_ContainerWidget)
+                m_NameIndexContainers.push_back(i);
+        }
+
+        m_NameIndexNeedsRebuild = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::scheduleChildUpdate(Widget* widget)
+    {
+        if (m_Parent)
+            m_Parent->scheduleChildUpdate(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::scheduleChildCallbacks(Widget* widget)
+    {
+        if (m_Parent)
+            m_Parent->scheduleChildCallbacks(widget);
+        else
+            widget->sendCoalescedCallbacks();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::registerScheduledUpdates(Widget* widget)
+    {
+        // Widgets that still rely on m_AnimatedWidget want to be updated every frame
+        if (widget->m_AnimatedWidget && !widget->m_UpdateScheduled)
+        {
+            widget->m_UpdateScheduled = true;
+            widget->m_UpdateDelay = sf::Time::Zero;
+        }
+
+        if (widget->m_UpdateScheduled && (widget->m_UpdateScheduler == nullptr))
+            scheduleChildUpdate(widget);
+
+        if (widget->m_ContainerWidget)
+        {
+            Container* container = static_cast<Container*>(widget);
+            for (unsigned int i = 0; i < container->m_Widgets.size(); ++i)
+                registerScheduledUpdates(container->m_Widgets[i].get());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::unregisterScheduledUpdates(Widget* widget)
+    {
+        if (widget->m_UpdateScheduler)
+            widget->m_UpdateScheduler->unscheduleUpdate(widget);
+
+        if (widget->m_CoalescedCallbackScheduler)
+            widget->m_CoalescedCallbackScheduler->unscheduleCallbacks(widget);
+
+        if (widget->m_ContainerWidget)
+        {
+            Container* container = static_cast<Container*>(widget);
+            for (unsigned int i = 0; i < container->m_Widgets.size(); ++i)
+                unregisterScheduledUpdates(container->m_Widgets[i].get());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        // Draw the cached widgets if possible
+        if (m_RenderCaching && drawRenderCache(*target, states))
+            return;
+
+        // The bounds of the widgets are relative to this position
+        sf::Vector2f offset = getAbsolutePosition() + getWidgetsOffset();
+
         // Draw all widgets when they are visible
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
             if (m_Widgets[i]->m_Visible)
+            {
+                // Don't draw widgets that lie completely outside the clipping area
+                sf::FloatRect bounds = m_Widgets[i]->getBounds();
+                if (!TGUI_Renderer.isVisible(*target, sf::FloatRect(offset.x + bounds.left, offset.y + bounds.top, bounds.width, bounds.height)))
+                    continue;
+
                 m_Widgets[i]->draw(*target, states);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::drawRenderCache(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        // The texture gets the size of the container in pixels, so that it looks the same as drawing the widgets directly
+        const sf::View& view = target.getView();
+        sf::Vector2f pixelsPerUnit(target.getSize().x * view.getViewport().width / view.getSize().x,
+                                   target.getSize().y * view.getViewport().height / view.getSize().y);
+
+        sf::Vector2u textureSize(static_cast<unsigned int>(std::ceil(getSize().x * pixelsPerUnit.x)),
+                                 static_cast<unsigned int>(std::ceil(getSize().y * pixelsPerUnit.y)));
+
+        // There is nothing to draw when the container has no size
+        if ((textureSize.x == 0) || (textureSize.y == 0))
+            return true;
+
+        // The cached widgets are drawn with a shader, without it the widgets are drawn directly
+        if (!sf::Shader::isAvailable())
+            return false;
+
+        if (m_RenderCache == nullptr)
+            m_RenderCache = new sf::RenderTexture();
+
+        if (m_RenderCache->getSize() != textureSize)
+        {
+            if (!m_RenderCache->create(textureSize.x, textureSize.y))
+            {
+                TGUI_OUTPUT("TGUI warning: Failed to create the render texture for render caching.");
+                return false;
+            }
+
+            m_RenderCacheNeedsUpdate = true;
+        }
+
+        if (m_RenderCacheNeedsUpdate)
+        {
+            TGUI_Renderer.pushTarget(*m_RenderCache);
+
+            // The view shows the part of the screen where the container is located, so that the widgets can draw themselves
+            // exactly like they would on the target (including their clipping)
+            sf::Vector2f topLeft = states.transform.transformPoint(0, 0);
+            m_RenderCache->setView(sf::View(sf::FloatRect(topLeft.x, topLeft.y, getSize().x, getSize().y)));
+            m_RenderCache->clear(sf::Color::Transparent);
+
+            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+            {
+                if (m_Widgets[i]->m_Visible)
+                    m_Widgets[i]->draw(*m_RenderCache, states);
+            }
+
+            TGUI_Renderer.popTarget();
+            m_RenderCache->display();
+
+            m_RenderCacheNeedsUpdate = false;
         }
+
+        // The colors in the texture were already blended with their alpha value, the renderer makes sure this isn't done twice
+        sf::Sprite sprite(m_RenderCache->getTexture());
+        sprite.setScale(1 / pixelsPerUnit.x, 1 / pixelsPerUnit.y);
+        return TGUI_Renderer.drawRenderTexture(target, sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    GuiContainer::GuiContainer() :
+    m_Window                   (nullptr),
+    m_RedrawNeeded             (true),
+    m_TimerWheelSlotDuration   (sf::milliseconds(16)),
+    m_TimerWheel               (64),
+    m_NextUpdateTimeNeedsUpdate(false),
+    m_NextUpdateTimeFound      (false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiContainer::~GuiContainer()
+    {
+        // The widgets have to be removed from the timer wheel while it still exists
+        removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::unbindGlobalCallback()
     {
         m_GlobalCallbackFunctions.erase(++m_GlobalCallbackFunctions.begin(), m_GlobalCallbackFunctions.end());
@@ -1350,6 +1897,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        Container::invalidate();
+        m_RedrawNeeded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool GuiContainer::mouseOnWidget(float, float)
     {
         return true;
@@ -1362,6 +1917,166 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleChildUpdate(Widget* widget)
+    {
+        // Forget about the update that was scheduled before
+        if (widget->m_UpdateScheduler)
+            widget->m_UpdateScheduler->unscheduleUpdate(widget);
+
+        widget->m_UpdateScheduler = this;
+        widget->m_UpdateTime = m_Time + widget->m_UpdateDelay;
+
+        sf::Int64 slot = widget->m_UpdateTime.asMicroseconds() / m_TimerWheelSlotDuration.asMicroseconds();
+        m_TimerWheel[slot % m_TimerWheel.size()].push_back(widget);
+
+        // Check if this widget has to be updated before all the others
+        if (!m_NextUpdateTimeNeedsUpdate && (!m_NextUpdateTimeFound || (widget->m_UpdateTime < m_NextUpdateTime)))
+        {
+            m_NextUpdateTime = widget->m_UpdateTime;
+            m_NextUpdateTimeFound = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::unscheduleUpdate(Widget* widget)
+    {
+        sf::Int64 slot = widget->m_UpdateTime.asMicroseconds() / m_TimerWheelSlotDuration.asMicroseconds();
+        std::vector<Widget*>& widgets = m_TimerWheel[slot % m_TimerWheel.size()];
+        widgets.erase(std::remove(widgets.begin(), widgets.end(), widget), widgets.end());
+
+        // The widget may also be waiting for its update function to be called
+        std::replace(m_DueWidgets.begin(), m_DueWidgets.end(), widget, static_cast<Widget*>(nullptr));
+
+        // When this was the first widget to be updated then another widget will be the first one now
+        if (m_NextUpdateTimeFound && (widget->m_UpdateTime == m_NextUpdateTime))
+            m_NextUpdateTimeNeedsUpdate = true;
+
+        widget->m_UpdateScheduler = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::updateTime(const sf::Time& elapsedTime)
+    {
+        sf::Int64 slot = m_Time.asMicroseconds() / m_TimerWheelSlotDuration.asMicroseconds();
+        m_Time += elapsedTime;
+        sf::Int64 lastSlot = m_Time.asMicroseconds() / m_TimerWheelSlotDuration.asMicroseconds();
+
+        // When more time passed than a full turn of the wheel then every slot only has to be checked once
+        if (lastSlot - slot >= static_cast<sf::Int64>(m_TimerWheel.size()))
+            lastSlot = slot + m_TimerWheel.size() - 1;
+
+        // Find the widgets whose time has come in the slots that the wheel passed
+        for (; slot <= lastSlot; ++slot)
+        {
+            std::vector<Widget*>& widgets = m_TimerWheel[slot % m_TimerWheel.size()];
+            for (unsigned int i = 0; i < widgets.size();)
+            {
+                if (widgets[i]->m_UpdateTime <= m_Time)
+                {
+                    m_DueWidgets.push_back(widgets[i]);
+                    widgets[i] = widgets.back();
+                    widgets.pop_back();
+                }
+                else
+                    ++i;
+            }
+        }
+
+        // The widgets that are left in the wheel all have to wait longer
+        if (!m_DueWidgets.empty())
+            m_NextUpdateTimeNeedsUpdate = true;
+
+        // Update the widgets. The list can change while doing so, widgets that are removed are replaced by a nullptr.
+        for (unsigned int i = 0; i < m_DueWidgets.size(); ++i)
+        {
+            Widget* widget = m_DueWidgets[i];
+            if (widget == nullptr)
+                continue;
+
+            widget->m_UpdateScheduled = false;
+            widget->m_UpdateScheduler = nullptr;
+            widget->m_AnimationTimeElapsed += m_Time - (widget->m_UpdateTime - widget->m_UpdateDelay);
+            widget->update();
+
+            // Widgets that still rely on m_AnimatedWidget are updated again during the next frame
+            if (widget->m_AnimatedWidget && !widget->m_UpdateScheduled)
+                widget->scheduleUpdate(sf::Time::Zero);
+        }
+
+        m_DueWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::getNextUpdateTime(sf::Time& updateTime) const
+    {
+        // The wheel is only searched when the widget that had to be updated first is no longer in it
+        if (m_NextUpdateTimeNeedsUpdate)
+        {
+            m_NextUpdateTimeFound = false;
+            for (auto slot = m_TimerWheel.cbegin(); slot != m_TimerWheel.cend(); ++slot)
+            {
+                for (auto it = slot->cbegin(); it != slot->cend(); ++it)
+                {
+                    if (!m_NextUpdateTimeFound || ((*it)->m_UpdateTime < m_NextUpdateTime))
+                    {
+                        m_NextUpdateTime = (*it)->m_UpdateTime;
+                        m_NextUpdateTimeFound = true;
+                    }
+                }
+            }
+
+            m_NextUpdateTimeNeedsUpdate = false;
+        }
+
+        if (m_NextUpdateTimeFound)
+            updateTime = m_NextUpdateTime;
+
+        return m_NextUpdateTimeFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleChildCallbacks(Widget* widget)
+    {
+        widget->m_CoalescedCallbackScheduler = this;
+        m_CoalescedCallbackWidgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::unscheduleCallbacks(Widget* widget)
+    {
+        std::replace(m_CoalescedCallbackWidgets.begin(), m_CoalescedCallbackWidgets.end(), widget, static_cast<Widget*>(nullptr));
+
+        widget->m_CoalescedCallbacks.clear();
+        widget->m_CoalescedCallbackScheduler = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::sendCoalescedCallbacks()
+    {
+        // Widgets that hold back new callbacks while the callbacks are being sent are added behind the current ones.
+        // They will only be handled during the next frame.
+        const std::size_t count = m_CoalescedCallbackWidgets.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Widget* widget = m_CoalescedCallbackWidgets[i];
+            if (widget == nullptr)
+                continue;
+
+            widget->m_CoalescedCallbackScheduler = nullptr;
+            widget->sendCoalescedCallbacks();
+        }
+
+        m_CoalescedCallbackWidgets.erase(m_CoalescedCallbackWidgets.begin(), m_CoalescedCallbackWidgets.begin() + count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
@@ -56,7 +54,6 @@ namespace tgui
     m_SeparateHoverImage    (false)
     {
         m_Callback.widgetType = Type_EditBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
         m_AllowFocus = true;
 
@@ -180,6 +177,8 @@ namespace tgui
 
     bool EditBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -376,7 +375,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -389,13 +388,13 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -441,7 +440,7 @@ namespace tgui
 
     void EditBox::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         if (m_SplitImage)
         {
@@ -483,6 +482,8 @@ namespace tgui
 
     void EditBox::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -512,9 +513,9 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
             m_TextureNormal_M.sprite.setScale(scalingY, scalingY);
@@ -543,6 +544,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -614,23 +617,23 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x > width)
+            while (getTextWidth(m_DisplayedText.getSize()) > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_Text.erase(m_Text.getSize()-1);
                 m_DisplayedText.erase(m_DisplayedText.getSize()-1);
-
-                // Set the new text
-                m_TextBeforeSelection.setString(m_DisplayedText);
             }
 
+            // Set the new text
+            m_TextBeforeSelection.setString(m_DisplayedText);
+
             // Set the full text again
             m_TextFull.setString(m_DisplayedText);
         }
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = getTextWidth(m_DisplayedText.getSize());
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -657,6 +660,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -675,6 +680,11 @@ namespace tgui
 
     void EditBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
+        // The font may have been reloaded, or it may be a new font at the address of a destroyed one
+        TGUI_TextMetrics.removeFont(font);
+
         m_TextBeforeSelection.setFont(font);
         m_TextSelection.setFont(font);
         m_TextAfterSelection.setFont(font);
@@ -694,6 +704,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -716,6 +728,8 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -748,6 +762,8 @@ namespace tgui
 
     void EditBox::setBorders(unsigned int borderLeft, unsigned int borderTop, unsigned int borderRight, unsigned int borderBottom)
     {
+        invalidate();
+
         // Set the new border size
         m_LeftBorder   = borderLeft;
         m_TopBorder    = borderTop;
@@ -769,6 +785,8 @@ namespace tgui
                                const sf::Color& selectedBgrColor,
                                const sf::Color& selectionPointColor)
     {
+        invalidate();
+
         m_TextBeforeSelection.setColor(color);
         m_TextSelection.setColor(selectedColor);
         m_TextAfterSelection.setColor(color);
@@ -781,6 +799,8 @@ namespace tgui
 
     void EditBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection.setColor(textColor);
     }
@@ -789,6 +809,8 @@ namespace tgui
 
     void EditBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_TextSelection.setColor(selectedTextColor);
     }
 
@@ -796,6 +818,8 @@ namespace tgui
 
     void EditBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        invalidate();
+
         m_SelectedTextBackground.setFillColor(selectedTextBackgroundColor);
     }
 
@@ -803,6 +827,8 @@ namespace tgui
 
     void EditBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        invalidate();
+
         m_SelectionPoint.setFillColor(selectionPointColor);
     }
 
@@ -855,14 +881,15 @@ namespace tgui
                 width = 0;
 
             // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_DisplayedText.getSize()).x - m_TextBeforeSelection.getPosition().x > width)
+            while (getTextWidth(m_DisplayedText.getSize()) > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_Text.erase(m_Text.getSize()-1);
                 m_DisplayedText.erase(m_DisplayedText.getSize()-1);
-                m_TextBeforeSelection.setString(m_DisplayedText);
             }
 
+            m_TextBeforeSelection.setString(m_DisplayedText);
+
             // The full text might have changed
             m_TextFull.setString(m_DisplayedText);
 
@@ -879,6 +906,8 @@ namespace tgui
 
     void EditBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        invalidate();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -909,7 +938,7 @@ namespace tgui
                 width = 0;
 
             // Find out the position of the selection point
-            float selectionPointPosition = m_TextFull.findCharacterPos(m_SelEnd).x;
+            float selectionPointPosition = getTextWidth(m_SelEnd);
 
             if (m_SelEnd == m_DisplayedText.getSize())
                 selectionPointPosition += m_TextFull.getCharacterSize() / 10.f;
@@ -930,6 +959,8 @@ namespace tgui
 
     void EditBox::setSelectionPointWidth(unsigned int width)
     {
+        invalidate();
+
         m_SelectionPoint.setPosition(m_SelectionPoint.getPosition().x + ((m_SelectionPoint.getSize().x - width) / 2.0f), m_SelectionPoint.getPosition().y);
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(width),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
@@ -947,6 +978,8 @@ namespace tgui
 
     void EditBox::setNumbersOnly(bool numbersOnly)
     {
+        invalidate();
+
         m_NumbersOnly = numbersOnly;
 
         // Remove all letters from the edit box if needed
@@ -984,6 +1017,8 @@ namespace tgui
 
     void EditBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
@@ -1006,6 +1041,8 @@ namespace tgui
 
     void EditBox::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1066,7 +1103,7 @@ namespace tgui
         m_MouseDown = true;
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -1078,7 +1115,7 @@ namespace tgui
 
         // The selection point should be visible
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1097,6 +1134,8 @@ namespace tgui
         // Check if the mouse is hold down (we are selecting multiple characters)
         if (m_MouseDown)
         {
+            invalidate();
+
             // Check if there is a text width limit
             if (m_LimitTextWidth)
             {
@@ -1138,19 +1177,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width))
+                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (getTextWidth(m_DisplayedText.getSize()) > width))
                 {
                     // Move the text by a few pixels
                     if (m_TextFull.getCharacterSize() > 10)
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10))
+                        if (m_TextCropPosition + width < getTextWidth(m_DisplayedText.getSize()) + (m_TextFull.getCharacterSize() / 10))
                             m_TextCropPosition += static_cast<unsigned int>(std::floor(m_TextFull.getCharacterSize() / 10.f + 0.5f));
                         else
-                            m_TextCropPosition = static_cast<unsigned int>(m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10) - width);
+                            m_TextCropPosition = static_cast<unsigned int>(getTextWidth(m_DisplayedText.getSize()) + (m_TextFull.getCharacterSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x)
+                        if (m_TextCropPosition + width < getTextWidth(m_DisplayedText.getSize()))
                             ++m_TextCropPosition;
                     }
                 }
@@ -1211,6 +1250,8 @@ namespace tgui
 
     void EditBox::keyPressed(const sf::Event::KeyEvent& event)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -1236,7 +1277,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Right)
         {
@@ -1258,7 +1299,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Home)
         {
@@ -1267,7 +1308,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::End)
         {
@@ -1276,12 +1317,12 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Return)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 m_Callback.text    = m_Text;
@@ -1316,7 +1357,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = getTextWidth(m_DisplayedText.getSize());
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1332,10 +1373,10 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
                 m_Callback.text    = m_Text;
@@ -1370,7 +1411,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = getTextWidth(m_DisplayedText.getSize());
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1386,10 +1427,10 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
                 m_Callback.text    = m_Text;
@@ -1424,7 +1465,7 @@ namespace tgui
                         setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
 
                         // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        if (isCallbackBound(TextChanged))
                         {
                             m_Callback.trigger = TextChanged;
                             m_Callback.text    = m_Text;
@@ -1458,6 +1499,8 @@ namespace tgui
 
     void EditBox::textEntered(sf::Uint32 key)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -1526,7 +1569,7 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width)
+            if (getTextWidth(m_DisplayedText.getSize()) > width)
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_Text.erase(m_SelEnd, 1);
@@ -1540,10 +1583,10 @@ namespace tgui
 
         // The selection point should be visible again
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(500));
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[TextChanged].empty() == false)
+        if (isCallbackBound(TextChanged))
         {
             m_Callback.trigger = TextChanged;
             m_Callback.text    = m_Text;
@@ -1553,6 +1596,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::widgetFocused()
+    {
+        // Start blinking the selection point
+        m_SelectionPointVisible = true;
+        scheduleUpdate(sf::milliseconds(500));
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::widgetUnfocused()
     {
         // If there is a selection then undo it now
@@ -1711,9 +1765,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(TextChanged))
                 callbacks.push_back("TextChanged");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -1753,12 +1807,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float EditBox::getTextWidth(unsigned int length) const
+    {
+        if (m_TextFull.getFont() == nullptr)
+            return 0;
+
+        return TGUI_TextMetrics.getTextWidth(*m_TextFull.getFont(), m_TextFull.getCharacterSize(), m_DisplayedText, 0, length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     unsigned int EditBox::findSelectionPointPosition(float posX)
     {
         // This code will crash when the editbox is empty. We need to avoid this.
-        if (m_DisplayedText.isEmpty())
+        if (m_DisplayedText.isEmpty() || (m_TextFull.getFont() == nullptr))
             return 0;
 
+        // Find the position of every character in the text
+        std::vector<float> positions;
+        TGUI_TextMetrics.getCharacterPositions(*m_TextFull.getFont(), m_TextFull.getCharacterSize(), m_DisplayedText, positions);
+
         // Find out what the first visible character is
         unsigned int firstVisibleChar;
         if (m_TextCropPosition)
@@ -1767,18 +1835,12 @@ namespace tgui
             firstVisibleChar = m_SelEnd;
 
             // Go backwards to find the character
-            while (m_TextFull.findCharacterPos(firstVisibleChar-1).x > m_TextCropPosition)
+            while ((firstVisibleChar > 0) && (positions[firstVisibleChar-1] > m_TextCropPosition))
                 --firstVisibleChar;
         }
         else // If the first part is visible then the first character is also visible
             firstVisibleChar = 0;
 
-        sf::String tempString;
-        float textWidthWithoutLastChar;
-        float fullTextWidth;
-        float halfOfLastCharWidth;
-        unsigned int lastVisibleChar;
-
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1795,7 +1857,7 @@ namespace tgui
         if (m_TextAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = positions.back();
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1809,46 +1871,21 @@ namespace tgui
         }
 
         // Find out what the last visible character is, starting from the selection point
-        lastVisibleChar = m_SelEnd;
+        unsigned int lastVisibleChar = m_SelEnd;
 
         // Go forward to find the character
-        while (m_TextFull.findCharacterPos(lastVisibleChar+1).x < m_TextCropPosition + width)
-        {
-            if (lastVisibleChar == m_DisplayedText.getSize())
-                break;
-
+        while ((lastVisibleChar < m_DisplayedText.getSize()) && (positions[lastVisibleChar+1] < m_TextCropPosition + width))
             ++lastVisibleChar;
-        }
-
-        // Set the first part of the text
-        tempString = m_DisplayedText.toWideString().substr(0, firstVisibleChar);
-        m_TextFull.setString(tempString);
-
-        // Calculate the first position
-        fullTextWidth = m_TextFull.findCharacterPos(firstVisibleChar).x;
 
         // for all the other characters, check where you have clicked.
         for (unsigned int i = firstVisibleChar; i < lastVisibleChar; ++i)
         {
-            // Add the next character to the temporary string
-            tempString += m_DisplayedText[i];
-            m_TextFull.setString(tempString);
-
-            // Make some calculations
-            textWidthWithoutLastChar = fullTextWidth;
-            fullTextWidth = m_TextFull.findCharacterPos(i + 1).x;
-            halfOfLastCharWidth = (fullTextWidth - textWidthWithoutLastChar) / 2.0f;
-
             // Check if you have clicked on the first halve of that character
-            if (posX < textWidthWithoutLastChar + pixelsToMove + halfOfLastCharWidth - m_TextCropPosition)
-            {
-                m_TextFull.setString(m_DisplayedText);
+            if (posX < positions[i] + pixelsToMove + ((positions[i+1] - positions[i]) / 2.0f) - m_TextCropPosition)
                 return i;
-            }
         }
 
         // If you pass here then you clicked behind all the characters
-        m_TextFull.setString(m_DisplayedText);
         return lastVisibleChar;
     }
 
@@ -1892,7 +1929,7 @@ namespace tgui
             width = 0;
 
         // Calculate the text width
-        float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+        float textWidth = getTextWidth(m_DisplayedText.getSize());
 
         // If the text can be moved to the right then do so
         if (textWidth > width)
@@ -1931,7 +1968,7 @@ namespace tgui
             float width = m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale);
 
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = getTextWidth(m_DisplayedText.getSize());
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1981,7 +2018,7 @@ namespace tgui
         }
 
         // Set the position of the selection point
-        selectionPointLeft += m_TextFull.findCharacterPos(m_SelEnd).x - (m_SelectionPoint.getSize().x * 0.5f);
+        selectionPointLeft += getTextWidth(m_SelEnd) - (m_SelectionPoint.getSize().x * 0.5f);
         m_SelectionPoint.setPosition(std::floor(selectionPointLeft + 0.5f), std::floor((m_TopBorder * scaling.y) + getPosition().y + 0.5f));
     }
 
@@ -1997,12 +2034,9 @@ namespace tgui
 
     void EditBox::update()
     {
-        // Only show/hide the selection point every half second
-        if (m_AnimationTimeElapsed < sf::milliseconds(500))
-            return;
-
-        // Reset the elapsed time
-        m_AnimationTimeElapsed = sf::Time();
+        // Keep blinking as long as the edit box is focused
+        if (m_Focused)
+            scheduleUpdate(sf::milliseconds(500));
 
         // Only update when the editbox is visible
         if (m_Visible == false)
@@ -2011,6 +2045,10 @@ namespace tgui
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn when focused
+        if (m_Focused)
+            invalidate();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
     }
@@ -2029,38 +2067,38 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_L, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_L, states);
-                target.draw(m_TextureNormal_M, states);
-                target.draw(m_TextureNormal_R, states);
+                TGUI_Renderer.draw(target, m_TextureNormal_L, states);
+                TGUI_Renderer.draw(target, m_TextureNormal_M, states);
+                TGUI_Renderer.draw(target, m_TextureNormal_R, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_R, states);
                 }
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_L, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_M, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_R, states);
             }
         }
         else // The images aren't split
@@ -2068,22 +2106,22 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
                 else
-                    target.draw(m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_M, states);
+                TGUI_Renderer.draw(target, m_TextureNormal_M, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureHover_M, states);
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-                target.draw(m_TextureFocused_M, states);
+                TGUI_Renderer.draw(target, m_TextureFocused_M, states);
         }
 
         // Calculate the scaling
@@ -2096,52 +2134,26 @@ namespace tgui
         else
             borderScale = scaling.x;
 
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x + (m_LeftBorder * borderScale) - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y + (m_TopBorder * scaling.y) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + (m_Size.x - (m_RightBorder * borderScale)) - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + (m_Size.y - (m_BottomBorder * scaling.y)) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Only allow drawing the text inside the borders
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x + (m_LeftBorder * borderScale), getAbsolutePosition().y + (m_TopBorder * scaling.y),
+                                                          m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale), m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y)));
 
-        target.draw(m_TextBeforeSelection, states);
+        TGUI_Renderer.draw(target, m_TextBeforeSelection, states);
 
         if (m_TextSelection.getString().isEmpty() == false)
         {
-            target.draw(m_SelectedTextBackground, states);
+            TGUI_Renderer.draw(target, m_SelectedTextBackground, states);
 
-            target.draw(m_TextSelection, states);
-            target.draw(m_TextAfterSelection, states);
+            TGUI_Renderer.draw(target, m_TextSelection, states);
+            TGUI_Renderer.draw(target, m_TextAfterSelection, states);
         }
 
         // Draw the selection point
         if ((m_Focused) && (m_SelectionPointVisible))
-            target.draw(m_SelectionPoint, states);
+            TGUI_Renderer.draw(target, m_SelectionPoint, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,10 @@ namespace tgui
 {
     TextureManager TGUI_TextureManager;
 
+    Renderer TGUI_Renderer;
+
+    TextMetrics TGUI_TextMetrics;
+
     Clipboard TGUI_Clipboard;
 
     bool TGUI_TabKeyUsageEnabled = true;
@@ -56,6 +60,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void enableTextureAtlas(unsigned int pageSize)
+    {
+        TGUI_TextureManager.enableAtlas(pageSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void disableTextureAtlas()
+    {
+        TGUI_TextureManager.disableAtlas();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void setResourcePath(const std::string& path)
     {
         TGUI_ResourcePath = path;
@@ -103,6 +103,8 @@ namespace tgui
 
     void Grid::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -125,6 +127,8 @@ namespace tgui
 
     void Grid::remove(const Widget::Ptr& widget)
     {
+        invalidate();
+
         remove(widget.get());
     }
 
@@ -132,6 +136,8 @@ namespace tgui
 
     void Grid::remove(Widget* widget)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (unsigned int row = 0; row < m_GridWidgets.size(); ++row)
         {
@@ -185,6 +191,8 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
+        invalidate();
+
         m_GridWidgets.clear();
         m_ObjBorders.clear();
         m_ObjLayout.clear();
@@ -203,6 +211,8 @@ namespace tgui
     void Grid::addWidget(const Widget::Ptr& widget, unsigned int row, unsigned int col,
                          const Borders& borders, Layout::Layouts layout)
     {
+        invalidate();
+
         // Create the row if it didn't exist yet
         if (m_GridWidgets.size() < row + 1)
         {
@@ -283,6 +293,8 @@ namespace tgui
 
     void Grid::changeWidgetBorders(const Widget::Ptr& widget, const Borders& borders)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (unsigned int row = 0; row < m_GridWidgets.size(); ++row)
         {
@@ -304,6 +316,8 @@ namespace tgui
 
     void Grid::changeWidgetLayout(const Widget::Ptr& widget, Layout::Layouts layout)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (unsigned int row = 0; row < m_GridWidgets.size(); ++row)
         {
@@ -535,8 +549,7 @@ namespace tgui
             mouseLeftWidget();
 
             // Tell the widgets inside the grid that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            unhoverWidgets();
 
             m_MouseHover = false;
         }
@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Gui.hpp>
@@ -36,8 +34,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
-        m_Window        (nullptr),
-        m_accessToWindow(false)
+        m_Window             (nullptr),
+        m_accessToWindow     (false),
+        m_DrawCallCount      (0),
+        m_FrameCaching       (false),
+        m_MaxCommandsPerFrame(0),
+        m_CommandsExecuted   (0)
     {
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
 
@@ -47,8 +49,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui(sf::RenderWindow& window) :
-        m_Window        (&window),
-        m_accessToWindow(true)
+        m_Window             (&window),
+        m_accessToWindow     (true),
+        m_DrawCallCount      (0),
+        m_FrameCaching       (false),
+        m_MaxCommandsPerFrame(0),
+        m_CommandsExecuted   (0)
     {
         m_Container.m_Window = &window;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
@@ -61,8 +67,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui(sf::RenderTarget& window) :
-        m_Window        (&window),
-        m_accessToWindow(false)
+        m_Window             (&window),
+        m_accessToWindow     (false),
+        m_DrawCallCount      (0),
+        m_FrameCaching       (false),
+        m_MaxCommandsPerFrame(0),
+        m_CommandsExecuted   (0)
     {
         m_Container.m_Window = &window;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
@@ -78,6 +88,7 @@ namespace tgui
 
         m_Window = &window;
         m_Container.m_Window = &window;
+        m_Container.invalidate();
 
         TGUI_Clipboard.setWindowHandle(window.getSystemHandle());
     }
@@ -90,6 +101,7 @@ namespace tgui
 
         m_Window = &window;
         m_Container.m_Window = &window;
+        m_Container.invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +115,9 @@ namespace tgui
 
     bool Gui::handleEvent(sf::Event event, bool resetView)
     {
+        // Apply the changes that other threads requested before handling the event
+        executeCommands();
+
         // Check if the event has something to do with the mouse
         if (event.type == sf::Event::MouseMoved)
         {
@@ -145,15 +160,23 @@ namespace tgui
         else if (event.type == sf::Event::LostFocus)
         {
             m_Container.m_Focused = false;
+            m_Container.invalidate();
         }
         else if (event.type == sf::Event::GainedFocus)
         {
             m_Container.m_Focused = true;
+            m_Container.invalidate();
 
             if (m_accessToWindow)
                 TGUI_Clipboard.setWindowHandle(static_cast<sf::RenderWindow*>(m_Window)->getSystemHandle());
         }
 
+        // The whole window has to be drawn again after it was resized
+        else if (event.type == sf::Event::Resized)
+        {
+            m_Container.invalidate();
+        }
+
         // Let the event manager handle the event
         return m_Container.handleEvent(event);
     }
@@ -168,57 +191,216 @@ namespace tgui
         if (resetView)
             m_Window->setView(m_Window->getDefaultView());
 
-        // Update the time
-        if (m_Container.m_Focused)
-            updateTime(m_Clock.restart());
-        else
-            m_Clock.restart();
+        // Apply the changes that other threads requested and update the time, the limit of commands starts over in every frame
+        updateTime();
+        m_CommandsExecuted = 0;
+
+        // Send the last callback of the coalesced triggers that occurred since the previous frame
+        m_Container.sendCoalescedCallbacks();
 
-        // Check if clipping is enabled
-        GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
-        GLint scissor[4];
+        // Callbacks that didn't fit in the queue earlier may fit now
+        m_Callback.flush();
 
-        if (clippingEnabled)
+        // The cached frame is drawn with a shader
+        if (m_FrameCaching && !sf::Shader::isAvailable())
         {
-            // Remember the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            TGUI_OUTPUT("TGUI warning: Frame caching requires shaders, which aren't supported.");
+            m_FrameCaching = false;
         }
-        else // Clipping was disabled
+
+        if (m_FrameCaching)
         {
-            // Enable clipping
-            glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_Window->getSize().x, m_Window->getSize().y);
+            // The cached frame can't be used when the window size or the view changed
+            const sf::View& view = m_Window->getView();
+            if ((m_FrameCache.getSize() != m_Window->getSize())
+             || (m_FrameCacheView.getViewport() != view.getViewport())
+             || !std::equal(view.getTransform().getMatrix(), view.getTransform().getMatrix() + 16, m_FrameCacheView.getTransform().getMatrix()))
+            {
+                if (m_FrameCache.getSize() != m_Window->getSize())
+                {
+                    if (!m_FrameCache.create(m_Window->getSize().x, m_Window->getSize().y))
+                    {
+                        TGUI_OUTPUT("TGUI warning: Failed to create the render texture for frame caching.");
+                        m_FrameCaching = false;
+                    }
+                }
+
+                m_FrameCacheView = view;
+                m_Container.invalidate();
+            }
         }
 
-        // Draw the window with all widgets inside it
-        m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default);
+        if (m_FrameCaching)
+        {
+            unsigned int drawCalls = 0;
+
+            // Only draw the widgets again when something changed
+            if (m_Container.m_RedrawNeeded)
+            {
+                m_FrameCache.setView(m_FrameCacheView);
+                m_FrameCache.clear(sf::Color::Transparent);
+
+                m_FrameCache.setActive(true);
+                drawWidgets(m_FrameCache);
+                m_FrameCache.display();
 
-        // Reset clipping to its original state
-        if (clippingEnabled)
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                drawCalls = m_DrawCallCount;
+            }
+
+            // Copy the cached frame to the window, pixel per pixel
+            m_Window->setView(m_Window->getDefaultView());
+            if (TGUI_Renderer.drawRenderTexture(*m_Window, sf::Sprite(m_FrameCache.getTexture())))
+            {
+                m_DrawCallCount = drawCalls + 1;
+            }
+            else // The shader couldn't be loaded
+            {
+                TGUI_OUTPUT("TGUI warning: Failed to load the shader for frame caching.");
+                m_FrameCaching = false;
+
+                m_Window->setView(m_FrameCacheView);
+                drawWidgets(*m_Window);
+            }
+        }
         else
-            glDisable(GL_SCISSOR_TEST);
+            drawWidgets(*m_Window);
+
+        m_Container.m_RedrawNeeded = false;
 
         m_Window->setView(oldView);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Gui::pollCallback(Callback& callback)
+    unsigned int Gui::getDrawCallCount() const
     {
-        // Check if the callback queue is empty
-        if (m_Callback.empty())
-            return false;
-        else // The queue is not empty
-        {
-            // Get the next callback
-            callback = m_Callback.front();
+        return m_DrawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRedrawNeeded() const
+    {
+        // When the limit of commands of this frame was reached, the frame has to be drawn to be able to apply the remaining ones
+        return m_Container.m_RedrawNeeded || !m_Commands.isEmpty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Remove the callback from the queue
-            m_Callback.pop();
+    void Gui::updateTime()
+    {
+        // Apply the changes that other threads requested, as far as the limit of this frame allows it
+        executeCommands();
+
+        // Give the animated widgets the chance to change
+        if (m_Container.m_Focused)
+            updateTime(m_Clock.restart());
+        else
+            m_Clock.restart();
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getTimeUntilNextUpdate(sf::Time& timeUntilUpdate) const
+    {
+        // There is no need to wait when the gui already changed or when other threads want to change it
+        if (m_Container.m_RedrawNeeded || !m_Commands.isEmpty())
+        {
+            timeUntilUpdate = sf::Time();
             return true;
         }
+
+        // The time doesn't advance while the window isn't focused
+        sf::Time updateTime;
+        if (!m_Container.m_Focused || !m_Container.getNextUpdateTime(updateTime))
+            return false;
+
+        // The clock of the widgets has not yet been advanced with the time since the last update
+        sf::Time currentTime = m_Container.m_Time + m_Clock.getElapsedTime();
+        if (updateTime > currentTime)
+            timeUntilUpdate = updateTime - currentTime;
+        else
+            timeUntilUpdate = sf::Time();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setFrameCaching(bool cacheFrames)
+    {
+        m_FrameCaching = cacheFrames;
+        m_Container.invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getFrameCaching() const
+    {
+        return m_FrameCaching;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setSpatialIndexing(bool useSpatialIndex, float cellSize)
+    {
+        m_Container.setSpatialIndexing(useSpatialIndex, cellSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getSpatialIndexing() const
+    {
+        return m_Container.getSpatialIndexing();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::pollCallback(Callback& callback)
+    {
+        return m_Callback.pop(callback);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::drainCallbacks(Callback* callbacks, std::size_t maxCount)
+    {
+        return m_Callback.pop(callbacks, maxCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setCallbackQueueThreadSafe(bool threadSafe)
+    {
+        m_Callback.setThreadSafe(threadSafe);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getCallbackQueueThreadSafe() const
+    {
+        return m_Callback.isThreadSafe();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> command)
+    {
+        m_Commands.push(std::move(command));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setMaxCommandsPerFrame(unsigned int maxCommands)
+    {
+        m_MaxCommandsPerFrame = maxCommands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getMaxCommandsPerFrame() const
+    {
+        return m_MaxCommandsPerFrame;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +475,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Gui::get(const Container::NameKey& widgetKey, bool recursive) const
+    {
+        return m_Container.get(widgetKey, recursive);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Gui::copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName)
     {
         return m_Container.copy(oldWidget, newWidgetName);
@@ -407,8 +596,7 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
-        m_Container.m_AnimationTimeElapsed = elapsedTime;
-        m_Container.update();
+        m_Container.updateTime(elapsedTime);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,6 +608,105 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets(sf::RenderTarget& target)
+    {
+        // Draw the window with all widgets inside it
+        TGUI_Renderer.beginFrame(target);
+        m_Container.drawWidgetContainer(&target, sf::RenderStates::Default);
+        TGUI_Renderer.endFrame();
+
+        m_DrawCallCount = TGUI_Renderer.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::executeCommands()
+    {
+        if (m_MaxCommandsPerFrame == 0)
+            m_Commands.execute(0);
+        else if (m_CommandsExecuted < m_MaxCommandsPerFrame)
+            m_CommandsExecuted += m_Commands.execute(m_MaxCommandsPerFrame - m_CommandsExecuted);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::CommandQueue() :
+    m_Head(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::~CommandQueue()
+    {
+        Node* node = m_Head.exchange(nullptr);
+        while (node)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::push(std::function<void()> command)
+    {
+        Node* node = new Node;
+        node->command = std::move(command);
+        node->next = m_Head.load(std::memory_order_relaxed);
+
+        // Place the node in front of the list, unless another thread did so in the meantime
+        while (!m_Head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CommandQueue::isEmpty() const
+    {
+        return m_Pending.empty() && (m_Head.load(std::memory_order_relaxed) == nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int CommandQueue::execute(unsigned int maxCommands)
+    {
+        // Take all functions that were pushed so far at once. The newest one comes first, so the list has to be reversed.
+        Node* node = m_Head.exchange(nullptr, std::memory_order_acquire);
+        Node* reversed = nullptr;
+        while (node)
+        {
+            Node* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed)
+        {
+            Node* next = reversed->next;
+            m_Pending.push_back(std::move(reversed->command));
+            delete reversed;
+            reversed = next;
+        }
+
+        // Execute the functions in the order in which they were pushed. A maximum of 0 means that there is no limit.
+        unsigned int executed = 0;
+        while (!m_Pending.empty() && ((maxCommands == 0) || (executed < maxCommands)))
+        {
+            std::function<void()> command = std::move(m_Pending.front());
+            m_Pending.pop_front();
+
+            command();
+            ++executed;
+        }
+
+        return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
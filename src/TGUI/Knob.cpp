@@ -112,6 +112,8 @@ namespace tgui
 
     bool Knob::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_loadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -207,7 +209,7 @@ namespace tgui
 
     void Knob::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_backgroundTexture.sprite.setPosition(x, y);
         m_foregroundTexture.sprite.setPosition(x + (m_backgroundTexture.getSize().x / 2.0f),
@@ -218,6 +220,8 @@ namespace tgui
 
     void Knob::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the knob wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -248,6 +252,8 @@ namespace tgui
 
     void Knob::setStartRotation(float startRotation)
     {
+        invalidate();
+
         while (startRotation >= 360)
             startRotation -= 360;
         while (startRotation < 0)
@@ -263,6 +269,8 @@ namespace tgui
 
     void Knob::setEndRotation(float endRotation)
     {
+        invalidate();
+
         while (endRotation >= 360)
             endRotation -= 360;
         while (endRotation < 0)
@@ -278,6 +286,8 @@ namespace tgui
 
     void Knob::setMinimum(int minimum)
     {
+        invalidate();
+
         if (m_minimum != minimum)
         {
             // Set the new minimum
@@ -300,6 +310,8 @@ namespace tgui
 
     void Knob::setMaximum(int maximum)
     {
+        invalidate();
+
         if (m_maximum != maximum)
         {
             // Set the new maximum
@@ -325,6 +337,8 @@ namespace tgui
 
     void Knob::setValue(int value)
     {
+        invalidate();
+
         if (m_value != value)
         {
             // Set the new value
@@ -340,7 +354,7 @@ namespace tgui
             recalculateRotation();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_value);
@@ -374,6 +388,8 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        invalidate();
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
@@ -391,6 +407,8 @@ namespace tgui
 
     void Knob::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_backgroundTexture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -662,7 +680,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -741,8 +759,8 @@ namespace tgui
 
     void Knob::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_backgroundTexture, states);
-        target.draw(m_foregroundTexture, states);
+        TGUI_Renderer.draw(target, m_backgroundTexture, states);
+        TGUI_Renderer.draw(target, m_foregroundTexture, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
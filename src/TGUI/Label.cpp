@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Label.hpp>
 
@@ -62,6 +60,8 @@ namespace tgui
 
     bool Label::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         // Don't continue when the config file was empty
         if (configFileFilename.empty())
             return true;
@@ -116,6 +116,8 @@ namespace tgui
 
     void Label::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -134,7 +136,7 @@ namespace tgui
 
     void Label::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_Text.setPosition(std::floor(x - m_Text.getLocalBounds().left + 0.5f), std::floor(y - m_Text.getLocalBounds().top + 0.5f));
         m_Background.setPosition(x, y);
@@ -144,6 +146,8 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        invalidate();
+
         m_Text.setString(string);
 
         setPosition(getPosition());
@@ -167,6 +171,8 @@ namespace tgui
 
     void Label::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
         setText(getText());
     }
@@ -182,6 +188,8 @@ namespace tgui
 
     void Label::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Text.setColor(color);
     }
 
@@ -196,6 +204,8 @@ namespace tgui
 
     void Label::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_Text.setCharacterSize(size);
 
         setPosition(getPosition());
@@ -219,6 +229,8 @@ namespace tgui
 
     void Label::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_Background.setFillColor(backgroundColor);
     }
 
@@ -233,6 +245,8 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        invalidateBounds();
+
         m_AutoSize = autoSize;
 
         // Change the size of the label if necessary
@@ -354,53 +368,25 @@ namespace tgui
         {
             // Draw the background
             if (m_Background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_Background, states);
+                TGUI_Renderer.draw(target, m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            TGUI_Renderer.draw(target, m_Text, states);
         }
         else
         {
-            const sf::View& view = target.getView();
-
-            // Calculate the scale factor of the view
-            float scaleViewX = target.getSize().x / view.getSize().x;
-            float scaleViewY = target.getSize().y / view.getSize().y;
-
-            // Get the global position
-            sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                        ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                            (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-            // Get the old clipping area
-            GLint scissor[4];
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-            // Calculate the clipping area
-            GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            // If the object outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            // Only allow drawing inside the label
+            TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
             // Draw the background
             if (m_Background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_Background, states);
+                TGUI_Renderer.draw(target, m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            TGUI_Renderer.draw(target, m_Text, states);
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            TGUI_Renderer.popClipping();
         }
     }
 
@@ -26,8 +26,6 @@
 #include <cmath>
 #include <algorithm>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/ListBox.hpp>
@@ -137,6 +135,8 @@ namespace tgui
 
     bool ListBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -249,6 +249,8 @@ namespace tgui
 
     void ListBox::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -292,10 +294,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect ListBox::getBounds() const
+    {
+        // The borders are drawn outside the list box
+        return sf::FloatRect(getPosition().x - m_LeftBorder, getPosition().y - m_TopBorder, getFullSize().x, getFullSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::changeColors(const sf::Color& backgroundColor,         const sf::Color& textColor,
                                const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor,
                                const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BackgroundColor         = backgroundColor;
         m_TextColor               = textColor;
         m_SelectedBackgroundColor = selectedBackgroundColor;
@@ -307,6 +319,8 @@ namespace tgui
 
     void ListBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -314,6 +328,8 @@ namespace tgui
 
     void ListBox::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextColor = textColor;
     }
 
@@ -321,6 +337,8 @@ namespace tgui
 
     void ListBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -328,6 +346,8 @@ namespace tgui
 
     void ListBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_SelectedTextColor = selectedTextColor;
     }
 
@@ -335,6 +355,8 @@ namespace tgui
 
     void ListBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -377,6 +399,8 @@ namespace tgui
 
     void ListBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_TextFont = &font;
     }
 
@@ -391,6 +415,8 @@ namespace tgui
 
     int ListBox::addItem(const sf::String& itemName, int id)
     {
+        invalidate();
+
         // Check if the item limit is reached (if there is one)
         if ((m_MaxItems == 0) || (m_Items.size() < m_MaxItems))
         {
@@ -424,6 +450,8 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         // Loop through all items
         for (unsigned int i = 0; i < m_Items.size(); ++i)
         {
@@ -457,6 +485,8 @@ namespace tgui
 
     bool ListBox::setSelectedItem(int index)
     {
+        invalidate();
+
         if (index < 0)
         {
             deselectItem();
@@ -490,6 +520,8 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        invalidate();
+
         m_SelectedItem = -1;
     }
 
@@ -497,6 +529,8 @@ namespace tgui
 
     bool ListBox::removeItem(unsigned int index)
     {
+        invalidate();
+
         // The index can't be too high
         if (index > m_Items.size()-1)
         {
@@ -525,6 +559,8 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         // Loop through all items
         for (unsigned int i = 0; i < m_Items.size(); ++i)
         {
@@ -556,6 +592,8 @@ namespace tgui
 
     unsigned int ListBox::removeItemsById(int id)
     {
+        invalidate();
+
         unsigned int removedItems = 0;
 
         for (unsigned int i = 0; i < m_Items.size();)
@@ -578,6 +616,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidate();
+
         // Clear the list, remove all items
         m_Items.clear();
         m_ItemIds.clear();
@@ -660,6 +700,8 @@ namespace tgui
 
     bool ListBox::changeItem(unsigned int index, const sf::String& newValue)
     {
+        invalidate();
+
         if (index >= m_Items.size()) {
             return false;
         }
@@ -672,6 +714,8 @@ namespace tgui
 
     unsigned int ListBox::changeItems(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         unsigned int amountChanged = 0;
         for (auto it = m_Items.begin(); it != m_Items.end(); ++it)
         {
@@ -689,6 +733,8 @@ namespace tgui
 
     unsigned int ListBox::changeItemsById(int id, const sf::String& newValue)
     {
+        invalidate();
+
         unsigned int amountChanged = 0;
         auto idIt = m_ItemIds.begin();
         for (auto it = m_Items.begin(); it != m_Items.end(); ++it, ++idIt)
@@ -707,6 +753,8 @@ namespace tgui
 
     bool ListBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Calling setScrollbar with an empty string does the same as removeScrollbar
         if (scrollbarConfigFileFilename.empty() == true)
         {
@@ -744,6 +792,8 @@ namespace tgui
 
     void ListBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -764,6 +814,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // There is a minimum height
         if (itemHeight < 10)
             itemHeight = 10;
@@ -804,6 +856,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(unsigned int maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_MaxItems = maximumItems;
 
@@ -831,6 +885,8 @@ namespace tgui
 
     void ListBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidateBounds();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -841,6 +897,8 @@ namespace tgui
 
     void ListBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         if (m_Scroll != nullptr)
@@ -884,6 +942,8 @@ namespace tgui
 
     void ListBox::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Set the mouse down flag to true
         m_MouseDown = true;
 
@@ -942,7 +1002,7 @@ namespace tgui
             }
 
             // Add the callback (if the user requested it)
-            if ((oldSelectedItem != m_SelectedItem) && (m_CallbackFunctions[ItemSelected].empty() == false))
+            if ((oldSelectedItem != m_SelectedItem) && (isCallbackBound(ItemSelected)))
             {
                 // When no item is selected then send an empty string, otherwise send the item
                 if (m_SelectedItem < 0)
@@ -961,6 +1021,8 @@ namespace tgui
 
     void ListBox::leftMouseReleased(float x, float y)
     {
+        invalidate();
+
         // If there is a scrollbar then pass it the event
         if (m_Scroll != nullptr)
         {
@@ -1019,14 +1081,27 @@ namespace tgui
             // Check if you are dragging the thumb of the scrollbar
             if ((m_Scroll->m_MouseDown) && (m_Scroll->m_MouseDownOnThumb))
             {
+                // Remember the old scrollbar value
+                unsigned int oldValue = m_Scroll->getValue();
+
                 // Pass the event, even when the mouse is not on top of the scrollbar
                 m_Scroll->mouseMoved(x, y);
+
+                // The items have moved when the value of the scrollbar has changed
+                if (oldValue != m_Scroll->getValue())
+                    invalidate();
             }
             else // You are just moving the mouse
             {
+                const bool scrollbarHovered = m_Scroll->m_MouseHover;
+
                 // When the mouse is on top of the scrollbar then pass the mouse move event
                 if (m_Scroll->mouseOnWidget(x, y))
                     m_Scroll->mouseMoved(x, y);
+
+                // The scrollbar looks different while the mouse is on top of it
+                if (m_Scroll->m_MouseHover != scrollbarHovered)
+                    invalidate();
             }
 
             // Reset the position
@@ -1038,6 +1113,8 @@ namespace tgui
 
     void ListBox::mouseWheelMoved(int delta, int, int)
     {
+        invalidate();
+
         // Only do something when there is a scrollbar
         if (m_Scroll != nullptr)
         {
@@ -1203,7 +1280,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ItemSelected))
                 callbacks.push_back("ItemSelected");
 
             encodeList(callbacks, value);
@@ -1251,31 +1328,6 @@ namespace tgui
 
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition;
-        sf::Vector2f bottomRightPosition;
-
-        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
-        {
-            topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                           ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - m_Scroll->getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                               (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-        }
-        else
-        {
-            topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                           ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                               (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-        }
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -1288,44 +1340,35 @@ namespace tgui
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
             border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw right border
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
             border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw bottom border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
         }
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
         front.setFillColor(m_BackgroundColor);
-        target.draw(front, states);
-
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+        TGUI_Renderer.draw(target, front, states);
 
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+        // Only allow drawing the items inside the list box, the scrollbar may not be drawn over
+        float clippingWidth = m_Size.x;
+        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
+            clippingWidth -= m_Scroll->getSize().x;
 
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, clippingWidth, m_Size.y));
 
         // Create a text widget to draw the items
         sf::Text text("", *m_TextFont, m_TextSize);
@@ -1344,9 +1387,6 @@ namespace tgui
             if ((m_Scroll->getValue() + m_Scroll->getLowValue()) % m_ItemHeight != 0)
                 ++lastItem;
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             for (unsigned int i = firstItem; i < lastItem; ++i)
             {
                 // Restore the transformations
@@ -1369,7 +1409,7 @@ namespace tgui
                         // Create and draw the background
                         sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_ItemHeight)));
                         back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
+                        TGUI_Renderer.draw(target, back, states);
 
                         // Restore the transformation
                         states.transform = storedTransform;
@@ -1385,14 +1425,11 @@ namespace tgui
                 states.transform.translate(2, std::floor(static_cast<float>(i * m_ItemHeight) - m_Scroll->getValue() + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
 
                 // Draw the text
-                target.draw(text, states);
+                TGUI_Renderer.draw(target, text, states);
             }
         }
         else // There is no scrollbar or it is invisible
         {
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             // Store the current transformations
             sf::Transform storedTransform = states.transform;
 
@@ -1415,7 +1452,7 @@ namespace tgui
                         // Create and draw the background
                         sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_ItemHeight)));
                         back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
+                        TGUI_Renderer.draw(target, back, states);
 
                         // Restore the transformation
                         states.transform = storedTransform;
@@ -1434,12 +1471,12 @@ namespace tgui
                 states.transform.translate(2, std::floor((i * m_ItemHeight) + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
 
                 // Draw the text
-                target.draw(text, states);
+                TGUI_Renderer.draw(target, text, states);
             }
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -119,6 +119,8 @@ namespace tgui
 
     bool LoadingBar::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -254,8 +256,8 @@ namespace tgui
                 m_Size.x = static_cast<float>(m_TextureBack_L.getSize().x + m_TextureBack_M.getSize().x + m_TextureBack_R.getSize().x);
                 m_Size.y = static_cast<float>(m_TextureBack_M.getSize().y);
 
-                m_TextureBack_M.data->texture.setRepeated(true);
-                m_TextureFront_M.data->texture.setRepeated(true);
+                m_TextureBack_M.setRepeated(true);
+                m_TextureFront_M.setRepeated(true);
             }
             else
             {
@@ -297,6 +299,8 @@ namespace tgui
 
     void LoadingBar::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -327,6 +331,8 @@ namespace tgui
 
     void LoadingBar::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -346,6 +352,8 @@ namespace tgui
 
     void LoadingBar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -365,6 +373,8 @@ namespace tgui
 
     void LoadingBar::setValue(unsigned int value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -382,13 +392,15 @@ namespace tgui
 
     unsigned int LoadingBar::incrementValue()
     {
+        invalidate();
+
         // When the value is still below the maximum then adjust it
         if (m_Value < m_Maximum)
         {
             ++m_Value;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -399,7 +411,7 @@ namespace tgui
             if (m_Value == m_Maximum)
             {
                 // Add the callback (if the user requested it)
-                if (m_CallbackFunctions[LoadingBarFull].empty() == false)
+                if (isCallbackBound(LoadingBarFull))
                 {
                     m_Callback.trigger = LoadingBarFull;
                     m_Callback.value   = static_cast<int>(m_Value);
@@ -440,6 +452,8 @@ namespace tgui
 
     void LoadingBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -476,6 +490,8 @@ namespace tgui
 
     void LoadingBar::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
     }
 
@@ -490,6 +506,8 @@ namespace tgui
 
     void LoadingBar::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Text.setColor(color);
     }
 
@@ -504,6 +522,8 @@ namespace tgui
 
     void LoadingBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -522,6 +542,8 @@ namespace tgui
 
     void LoadingBar::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureBack_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -615,9 +637,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(LoadingBarFull) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LoadingBarFull).size() == 1) && (m_CallbackFunctions.at(LoadingBarFull).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LoadingBarFull))
                 callbacks.push_back("LoadingBarFull");
 
             encodeList(callbacks, value);
@@ -663,9 +685,9 @@ namespace tgui
             float totalWidth = m_Size.x / (m_Size.y / m_TextureBack_M.getSize().y);
 
             // Get the bounds of the sprites
-            sf::IntRect bounds_L = m_TextureFront_L.sprite.getTextureRect();
-            sf::IntRect bounds_M = m_TextureFront_M.sprite.getTextureRect();
-            sf::IntRect bounds_R = m_TextureFront_R.sprite.getTextureRect();
+            sf::IntRect bounds_L = m_TextureFront_L.getTextureRect();
+            sf::IntRect bounds_M = m_TextureFront_M.getTextureRect();
+            sf::IntRect bounds_R = m_TextureFront_R.getTextureRect();
 
             // Calculate the size of the part to display
             float frontSize;
@@ -713,17 +735,17 @@ namespace tgui
                 bounds_R.width = 0;
             }
 
-            m_TextureFront_L.sprite.setTextureRect(bounds_L);
-            m_TextureFront_M.sprite.setTextureRect(bounds_M);
-            m_TextureFront_R.sprite.setTextureRect(bounds_R);
+            m_TextureFront_L.setTextureRect(bounds_L);
+            m_TextureFront_M.setTextureRect(bounds_M);
+            m_TextureFront_R.setTextureRect(bounds_R);
 
             // Make sure that the back image is displayed correctly
-            m_TextureBack_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
+            m_TextureBack_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
         }
         else // The image is not split
         {
             // Calculate the size of the front sprite
-            sf::IntRect frontBounds(m_TextureFront_M.sprite.getTextureRect());
+            sf::IntRect frontBounds(m_TextureFront_M.getTextureRect());
 
             // Only change the width when not dividing by zero
             if ((m_Maximum - m_Minimum) > 0)
@@ -732,7 +754,7 @@ namespace tgui
                 frontBounds.width = static_cast<int>(m_TextureBack_M.getSize().x);
 
             // Set the size of the front image
-            m_TextureFront_M.sprite.setTextureRect(frontBounds);
+            m_TextureFront_M.setTextureRect(frontBounds);
         }
     }
 
@@ -767,8 +789,8 @@ namespace tgui
             states.transform.scale(scalingY, scalingY);
 
             // Draw the left image of the loading bar
-            target.draw(m_TextureBack_L, states);
-            target.draw(m_TextureFront_L, states);
+            TGUI_Renderer.draw(target, m_TextureBack_L, states);
+            TGUI_Renderer.draw(target, m_TextureFront_L, states);
 
             // Check if the middle image may be drawn
             if ((scalingY * (m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x)) < m_Size.x)
@@ -777,15 +799,15 @@ namespace tgui
                 states.transform.translate(static_cast<float>(m_TextureBack_L.getSize().x), 0);
 
                 // Draw the middle image
-                target.draw(m_TextureBack_M, states);
-                target.draw(m_TextureFront_M, states);
+                TGUI_Renderer.draw(target, m_TextureBack_M, states);
+                TGUI_Renderer.draw(target, m_TextureFront_M, states);
 
                 // Put the right image on the correct position
                 states.transform.translate(m_TextureBack_M.sprite.getGlobalBounds().width, 0);
 
                 // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
+                TGUI_Renderer.draw(target, m_TextureBack_R, states);
+                TGUI_Renderer.draw(target, m_TextureFront_R, states);
             }
             else // The loading bar isn't width enough, we will draw it at minimum size
             {
@@ -793,8 +815,8 @@ namespace tgui
                 states.transform.translate(static_cast<float>(m_TextureBack_L.getSize().x), 0);
 
                 // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
+                TGUI_Renderer.draw(target, m_TextureBack_R, states);
+                TGUI_Renderer.draw(target, m_TextureFront_R, states);
             }
         }
         else // The image is not split
@@ -803,8 +825,8 @@ namespace tgui
             states.transform.scale(m_Size.x / m_TextureBack_M.getSize().x, m_Size.y / m_TextureBack_M.getSize().y);
 
             // Draw the loading bar
-            target.draw(m_TextureBack_M, states);
-            target.draw(m_TextureFront_M, states);
+            TGUI_Renderer.draw(target, m_TextureBack_M, states);
+            TGUI_Renderer.draw(target, m_TextureFront_M, states);
         }
 
         // Check if there is a text to draw
@@ -824,7 +846,7 @@ namespace tgui
             states.transform.translate(std::floor(rect.left + 0.5f), std::floor(rect.top + 0.5f));
 
             // Draw the text
-            target.draw(m_Text, states);
+            TGUI_Renderer.draw(target, m_Text, states);
         }
     }
 
@@ -62,6 +62,8 @@ namespace tgui
 
     bool MenuBar::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // Open the config file
@@ -128,6 +130,8 @@ namespace tgui
 
     void MenuBar::setSize(float width, float height)
     {
+        invalidateBounds();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -147,8 +151,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect MenuBar::getBounds() const
+    {
+        sf::FloatRect bounds(getPosition().x, getPosition().y, m_Size.x, m_Size.y);
+
+        // The open menu is drawn below the menu bar
+        if (m_VisibleMenu != -1)
+        {
+            // Find out where the menu starts
+            float menuLeft = 0;
+            for (int i = 0; i < m_VisibleMenu; ++i)
+                menuLeft += m_Menus[i].text.getLocalBounds().width + (2 * m_DistanceToSide);
+
+            // Find out what the width of the menu is
+            float menuWidth = static_cast<float>(m_MinimumSubMenuWidth);
+            for (unsigned int j = 0; j < m_Menus[m_VisibleMenu].menuItems.size(); ++j)
+            {
+                if (menuWidth < m_Menus[m_VisibleMenu].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide))
+                    menuWidth = m_Menus[m_VisibleMenu].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide);
+            }
+
+            if (bounds.width < menuLeft + menuWidth)
+                bounds.width = menuLeft + menuWidth;
+
+            bounds.height += m_Size.y * m_Menus[m_VisibleMenu].menuItems.size();
+        }
+
+        return bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
+
         Menu menu;
 
         menu.selectedMenuItem = -1;
@@ -165,6 +202,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -190,6 +229,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -214,6 +255,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -245,6 +288,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
+
         m_Menus.clear();
     }
 
@@ -253,6 +298,8 @@ namespace tgui
     void MenuBar::changeColors(const sf::Color& backgroundColor, const sf::Color& textColor,
                                const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
         m_TextColor = textColor;
         m_SelectedBackgroundColor = selectedBackgroundColor;
@@ -276,6 +323,8 @@ namespace tgui
 
     void MenuBar::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -283,6 +332,8 @@ namespace tgui
 
     void MenuBar::setTextColor(const sf::Color& textColor)
     {
+        invalidate();
+
         m_TextColor = textColor;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -301,6 +352,8 @@ namespace tgui
 
     void MenuBar::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        invalidate();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -308,6 +361,8 @@ namespace tgui
 
     void MenuBar::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        invalidate();
+
         m_SelectedTextColor = selectedTextColor;
 
         if (m_VisibleMenu != -1)
@@ -349,6 +404,8 @@ namespace tgui
 
     void MenuBar::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_TextFont = &font;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -375,6 +432,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_TextSize = size;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -397,6 +456,8 @@ namespace tgui
 
     void MenuBar::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidate();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -411,6 +472,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(unsigned int minimumWidth)
     {
+        invalidate();
+
         m_MinimumSubMenuWidth = minimumWidth;
     }
 
@@ -470,6 +533,8 @@ namespace tgui
 
     void MenuBar::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Check if a menu should be opened or closed
         if (y <= m_Size.y + getPosition().y)
         {
@@ -508,6 +573,8 @@ namespace tgui
 
     void MenuBar::leftMouseReleased(float, float y)
     {
+        invalidate();
+
         if (m_MouseDown)
         {
             // Check if the mouse is on top of one of the menus
@@ -517,7 +584,7 @@ namespace tgui
 
                 if (selectedMenuItem < m_Menus[m_VisibleMenu].menuItems.size())
                 {
-                    if (m_CallbackFunctions[MenuItemClicked].empty() == false)
+                    if (isCallbackBound(MenuItemClicked))
                     {
                         m_Callback.trigger = MenuItemClicked;
                         m_Callback.text = m_Menus[m_VisibleMenu].menuItems[selectedMenuItem].getString();
@@ -568,12 +635,15 @@ namespace tgui
                             // If one of the menu items is selected then unselect it
                             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                             {
+                                invalidate();
                                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_TextColor);
                                 m_Menus[m_VisibleMenu].selectedMenuItem = -1;
                             }
                         }
                         else // The menu isn't open yet
                         {
+                            invalidate();
+
                             // If there is another menu open then close it first
                             if (m_VisibleMenu != -1)
                             {
@@ -604,6 +674,8 @@ namespace tgui
             // Check if the mouse is on a different item than before
             if (selectedMenuItem != m_Menus[m_VisibleMenu].selectedMenuItem)
             {
+                invalidate();
+
                 // If another of the menu items is selected then unselect it
                 if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                     m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_TextColor);
@@ -622,6 +694,8 @@ namespace tgui
         // Check if there is still a menu open
         if (m_VisibleMenu != -1)
         {
+            invalidate();
+
             // If an item in that menu was selected then unselect it first
             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
             {
@@ -768,7 +842,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(MenuItemClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MenuItemClicked).size() == 1) && (m_CallbackFunctions.at(MenuItemClicked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(MenuItemClicked))
                 callbacks.push_back("MenuItemClicked");
 
             encodeList(callbacks, value);
@@ -820,7 +894,7 @@ namespace tgui
         // Draw the background
         sf::RectangleShape background(m_Size);
         background.setFillColor(m_BackgroundColor);
-        target.draw(background, states);
+        TGUI_Renderer.draw(target, background, states);
 
         if (m_Menus.empty())
             return;
@@ -837,7 +911,7 @@ namespace tgui
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), 0);
             states.transform.translate(textShift.x, textShift.y);
-            target.draw(m_Menus[i].text, states);
+            TGUI_Renderer.draw(target, m_Menus[i].text, states);
             states.transform.translate(-textShift.x, -textShift.y);
 
             // Is the menu open?
@@ -860,7 +934,7 @@ namespace tgui
                 // Draw the background of the menu
                 background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y * m_Menus[i].menuItems.size()));
                 background.setFillColor(m_BackgroundColor);
-                target.draw(background, states);
+                TGUI_Renderer.draw(target, background, states);
 
                 // If there is a selected menu item then draw its background
                 if (m_Menus[i].selectedMenuItem != -1)
@@ -868,7 +942,7 @@ namespace tgui
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * m_Size.y);
                     background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y));
                     background.setFillColor(m_SelectedBackgroundColor);
-                    target.draw(background, states);
+                    TGUI_Renderer.draw(target, background, states);
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * -m_Size.y);
                 }
 
@@ -878,7 +952,7 @@ namespace tgui
                 // Draw the menu items
                 for (unsigned int j = 0; j < m_Menus[i].menuItems.size(); ++j)
                 {
-                    target.draw(m_Menus[i].menuItems[j], states);
+                    TGUI_Renderer.draw(target, m_Menus[i].menuItems[j], states);
 
                     states.transform.translate(0, m_Size.y);
                 }
@@ -97,6 +97,8 @@ namespace tgui
 
     bool MessageBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -191,6 +193,8 @@ namespace tgui
 
     void MessageBox::setText(const sf::String& text)
     {
+        invalidate();
+
         if (m_Loaded)
         {
             m_Label->setText(text);
@@ -220,6 +224,8 @@ namespace tgui
 
     void MessageBox::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Label->setTextFont(font);
     }
 
@@ -234,6 +240,8 @@ namespace tgui
 
     void MessageBox::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_Label->setTextColor(color);
     }
 
@@ -248,6 +256,8 @@ namespace tgui
 
     void MessageBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_TextSize = size;
 
         if (m_Loaded)
@@ -272,6 +282,8 @@ namespace tgui
 
     void MessageBox::addButton(const sf::String& caption)
     {
+        invalidate();
+
         if (m_Loaded)
         {
             Button::Ptr button(*this);
@@ -367,7 +379,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ButtonClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ButtonClicked).size() == 1) && (m_CallbackFunctions.at(ButtonClicked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ButtonClicked))
                 callbacks.push_back("ButtonClicked");
 
             encodeList(callbacks, value);
@@ -400,6 +412,8 @@ namespace tgui
 
     void MessageBox::rearrange()
     {
+        invalidate();
+
         if (!m_Loaded)
             return;
 
@@ -451,7 +465,7 @@ namespace tgui
 
     void MessageBox::ButtonClickedCallbackFunction(const Callback& callback)
     {
-        if (m_CallbackFunctions[ButtonClicked].empty() == false)
+        if (isCallbackBound(ButtonClicked))
         {
             m_Callback.trigger = ButtonClicked;
             m_Callback.text    = static_cast<Button*>(callback.widget)->getText();
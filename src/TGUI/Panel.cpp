@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Panel.hpp>
 
@@ -95,6 +93,8 @@ namespace tgui
 
     void Panel::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -119,6 +119,8 @@ namespace tgui
 
     void Panel::setBackgroundTexture(sf::Texture *const texture)
     {
+        invalidate();
+
         // Store the texture
         m_Texture = texture;
 
@@ -141,6 +143,8 @@ namespace tgui
 
     void Panel::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -155,6 +159,8 @@ namespace tgui
 
     void Panel::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Container::setTransparency(transparency);
 
         m_Sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -177,8 +183,7 @@ namespace tgui
             mouseLeftWidget();
 
             // Tell the widgets inside the panel that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            unhoverWidgets();
 
             m_MouseHover = false;
         }
@@ -194,7 +199,7 @@ namespace tgui
         {
             m_MouseDown = true;
 
-            if (!m_CallbackFunctions[LeftMousePressed].empty())
+            if (isCallbackBound(LeftMousePressed))
             {
                 m_Callback.trigger = LeftMousePressed;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -212,7 +217,7 @@ namespace tgui
     {
         if (mouseOnWidget(x, y))
         {
-            if (!m_CallbackFunctions[LeftMouseReleased].empty())
+            if (isCallbackBound(LeftMouseReleased))
             {
                 m_Callback.trigger = LeftMouseReleased;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -222,7 +227,7 @@ namespace tgui
 
             if (m_MouseDown)
             {
-                if (!m_CallbackFunctions[LeftMouseClicked].empty())
+                if (isCallbackBound(LeftMouseClicked))
                 {
                     m_Callback.trigger = LeftMouseClicked;
                     m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -295,11 +300,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMouseReleased))
                 callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(LeftMouseClicked))
                 callbacks.push_back("LeftMouseClicked");
 
             encodeList(callbacks, value);
@@ -333,36 +338,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Only allow drawing inside the panel
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
         // Set the transform
         states.transform *= getTransform();
@@ -372,18 +349,18 @@ namespace tgui
         {
             sf::RectangleShape background(m_Size);
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            TGUI_Renderer.draw(target, background, states);
         }
 
         // Draw the background texture if there is one
         if (m_Texture)
-            target.draw(m_Sprite, states);
+            TGUI_Renderer.draw(target, m_Sprite, states);
 
         // Draw the widgets
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,6 +88,8 @@ namespace tgui
 
     bool Picture::load(const std::string& filename)
     {
+        invalidateBounds();
+
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
         m_Size.x = 0;
@@ -126,6 +128,8 @@ namespace tgui
 
     void Picture::loadFromTexture(const sf::Texture& texture)
     {
+        invalidate();
+
         m_LoadedFilename = "";
 
         if (m_Texture.data != nullptr)
@@ -152,7 +156,7 @@ namespace tgui
 
     void Picture::setPosition(float x, float y)
     {
-        Transformable::setPosition(x, y);
+        Widget::setPosition(x, y);
 
         m_Texture.sprite.setPosition(x, y);
     }
@@ -161,6 +165,8 @@ namespace tgui
 
     void Picture::setSize(float width, float height)
     {
+        invalidateBounds();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -174,8 +180,10 @@ namespace tgui
 
     void Picture::setSmooth(bool smooth)
     {
+        invalidate();
+
         if (m_Loaded)
-            m_Texture.data->texture.setSmooth(smooth);
+            m_Texture.setSmooth(smooth);
         else
             TGUI_OUTPUT("TGUI warning: Picture::setSmooth called while Picture wasn't loaded yet.");
     }
@@ -186,7 +194,7 @@ namespace tgui
     bool Picture::isSmooth() const
     {
         if (m_Loaded)
-            return m_Texture.data->texture.isSmooth();
+            return m_Texture.isSmooth();
         else
         {
             TGUI_OUTPUT("TGUI warning: Picture::isSmooth called while Picture wasn't loaded yet.");
@@ -198,6 +206,8 @@ namespace tgui
 
     void Picture::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_Texture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -290,7 +300,7 @@ namespace tgui
 
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_Texture, states);
+        TGUI_Renderer.draw(target, m_Texture, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
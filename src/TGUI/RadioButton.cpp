@@ -104,6 +104,8 @@ namespace tgui
 
     bool RadioButton::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -241,6 +243,8 @@ namespace tgui
 
     void RadioButton::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the radio button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -288,16 +292,19 @@ namespace tgui
 
     void RadioButton::check()
     {
+        invalidate();
+
         if (m_Checked == false)
         {
             // Tell our parent that all the radio buttons should be unchecked
-            m_Parent->uncheckRadioButtons();
+            if (m_Parent)
+                m_Parent->uncheckRadioButtons();
 
             // Check this radio button
             m_Checked = true;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Checked].empty() == false)
+            if (isCallbackBound(Checked))
             {
                 m_Callback.trigger = Checked;
                 m_Callback.checked = true;
@@ -310,12 +317,14 @@ namespace tgui
 
     void RadioButton::uncheck()
     {
+        invalidate();
+
         if (m_Checked)
         {
             m_Checked = false;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Unchecked].empty() == false)
+            if (isCallbackBound(Unchecked))
             {
                 m_Callback.trigger = Unchecked;
                 m_Callback.checked = false;
@@ -335,6 +344,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the radio button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -363,6 +374,8 @@ namespace tgui
 
     void RadioButton::setTextFont(const sf::Font& font)
     {
+        invalidate();
+
         m_Text.setFont(font);
     }
 
@@ -377,6 +390,8 @@ namespace tgui
 
     void RadioButton::setTextColor(const sf::Color& Color)
     {
+        invalidate();
+
         m_Text.setColor(Color);
     }
 
@@ -391,6 +406,8 @@ namespace tgui
 
     void RadioButton::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_TextSize = size;
 
@@ -416,6 +433,8 @@ namespace tgui
 
     void RadioButton::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureChecked.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -459,7 +478,7 @@ namespace tgui
     void RadioButton::leftMouseReleased(float x, float y)
     {
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.checked = m_Checked;
@@ -475,7 +494,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.checked = m_Checked;
@@ -499,7 +518,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -512,7 +531,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -627,13 +646,13 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(Checked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Checked).size() == 1) && (m_CallbackFunctions.at(Checked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Checked))
                 callbacks.push_back("Checked");
-            if ((m_CallbackFunctions.find(Unchecked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unchecked).size() == 1) && (m_CallbackFunctions.at(Unchecked).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Unchecked))
                 callbacks.push_back("Unchecked");
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(SpaceKeyPressed))
                 callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -677,20 +696,20 @@ namespace tgui
     void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_Checked)
-            target.draw(m_TextureChecked, states);
+            TGUI_Renderer.draw(target, m_TextureChecked, states);
         else
-            target.draw(m_TextureUnchecked, states);
+            TGUI_Renderer.draw(target, m_TextureUnchecked, states);
 
         // When the radio button is focused then draw an extra image
         if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-            target.draw(m_TextureFocused, states);
+            TGUI_Renderer.draw(target, m_TextureFocused, states);
 
         // When the mouse is on top of the radio button then draw an extra image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureHover, states);
+            TGUI_Renderer.draw(target, m_TextureHover, states);
 
         // Draw the text
-        target.draw(m_Text, states);
+        TGUI_Renderer.draw(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,450 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <cmath>
+
+#include <SFML/OpenGL.hpp>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Renderer::Renderer() :
+    m_Target                   (nullptr),
+    m_ClippingWasEnabled       (false),
+    m_Vertices                 (sf::Quads),
+    m_Texture                  (nullptr),
+    m_BlendMode                (sf::BlendAlpha),
+    m_DrawCalls                (0),
+    m_UnpremultiplyShaderLoaded(false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::beginFrame(sf::RenderTarget& target)
+    {
+        // Anything that was still waiting belongs to the previous frame
+        flush();
+
+        m_Target = &target;
+        m_DrawCalls = 0;
+
+        // This is the only place where the scissor state is queried
+        m_ClippingWasEnabled = (glIsEnabled(GL_SCISSOR_TEST) == GL_TRUE);
+
+        m_ClippingStack.clear();
+        if (m_ClippingWasEnabled)
+        {
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+            m_OldScissorBox = sf::IntRect(scissor[0], scissor[1], scissor[2], scissor[3]);
+            m_ClippingStack.push_back(sf::IntRect(scissor[0], static_cast<int>(target.getSize().y) - scissor[1] - scissor[3], scissor[2], scissor[3]));
+        }
+        else
+        {
+            glEnable(GL_SCISSOR_TEST);
+            m_ClippingStack.push_back(sf::IntRect(0, 0, target.getSize().x, target.getSize().y));
+        }
+
+        // Make sure that the scissor box is set
+        m_AppliedClipping = sf::IntRect(0, 0, -1, -1);
+        applyClipping();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::endFrame()
+    {
+        flush();
+
+        // Reset clipping to its original state
+        if (m_ClippingWasEnabled)
+            glScissor(m_OldScissorBox.left, m_OldScissorBox.top, m_OldScissorBox.width, m_OldScissorBox.height);
+        else
+            glDisable(GL_SCISSOR_TEST);
+
+        m_ClippingStack.clear();
+        m_Target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::pushTarget(sf::RenderTarget& target)
+    {
+        // What is waiting still has to end up on the old target
+        flush();
+
+        PreviousTarget previous;
+        previous.target = m_Target;
+        previous.appliedClipping = m_AppliedClipping;
+        previous.clippingStackSize = m_ClippingStack.size();
+        m_PreviousTargets.push_back(previous);
+
+        m_Target = &target;
+        activate(m_Target);
+
+        // The new target has its own context, in which the whole target is visible
+        glEnable(GL_SCISSOR_TEST);
+        m_ClippingStack.push_back(sf::IntRect(0, 0, target.getSize().x, target.getSize().y));
+        m_AppliedClipping = sf::IntRect(0, 0, -1, -1);
+        applyClipping();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::popTarget()
+    {
+        flush();
+
+        m_Target = m_PreviousTargets.back().target;
+        m_AppliedClipping = m_PreviousTargets.back().appliedClipping;
+        m_ClippingStack.resize(m_PreviousTargets.back().clippingStackSize);
+        m_PreviousTargets.pop_back();
+
+        // The gl calls have to be made on the context of the old target again
+        activate(m_Target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::pushClipping(sf::RenderTarget& target, const sf::FloatRect& rect)
+    {
+        // Find out which pixels are covered by the area
+        sf::Vector2i topLeft = target.mapCoordsToPixel(sf::Vector2f(rect.left, rect.top));
+        sf::Vector2i bottomRight = target.mapCoordsToPixel(sf::Vector2f(rect.left + rect.width, rect.top + rect.height));
+
+        // Without a frame the widget is drawn directly, so the scissor box is changed immediately like it is done inside a frame
+        if (!isBatching(target))
+        {
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+            DirectClipping direct;
+            direct.oldScissorBox = sf::IntRect(scissor[0], scissor[1], scissor[2], scissor[3]);
+            direct.clippingStackSize = m_ClippingStack.size() + 1;
+            m_DirectClipping.push_back(direct);
+
+            // Only the part that was already visible can be drawn
+            sf::IntRect oldClipping(scissor[0], static_cast<int>(target.getSize().y) - scissor[1] - scissor[3], scissor[2], scissor[3]);
+            sf::IntRect clipping;
+            if (!oldClipping.intersects(sf::IntRect(topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y), clipping))
+                clipping = sf::IntRect(oldClipping.left, oldClipping.top, 0, 0);
+
+            glScissor(clipping.left, static_cast<GLint>(target.getSize().y) - clipping.top - clipping.height, clipping.width, clipping.height);
+
+            // The stack has to stay balanced
+            m_ClippingStack.push_back(m_ClippingStack.empty() ? sf::IntRect() : m_ClippingStack.back());
+            return;
+        }
+
+        // Only the part that was already visible can be drawn
+        sf::IntRect clipping;
+        if (!m_ClippingStack.back().intersects(sf::IntRect(topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y), clipping))
+            clipping = sf::IntRect(m_ClippingStack.back().left, m_ClippingStack.back().top, 0, 0);
+
+        m_ClippingStack.push_back(clipping);
+        applyClipping();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::popClipping()
+    {
+        // Restore the scissor box when the clipping was pushed outside a frame
+        if (!m_DirectClipping.empty() && (m_DirectClipping.back().clippingStackSize == m_ClippingStack.size()))
+        {
+            const sf::IntRect& scissor = m_DirectClipping.back().oldScissorBox;
+            glScissor(scissor.left, scissor.top, scissor.width, scissor.height);
+            m_DirectClipping.pop_back();
+        }
+
+        m_ClippingStack.pop_back();
+
+        if ((m_Target != nullptr) && !m_ClippingStack.empty())
+            applyClipping();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Renderer::isVisible(sf::RenderTarget& target, const sf::FloatRect& rect) const
+    {
+        if (!isBatching(target) || m_ClippingStack.empty())
+            return true;
+
+        sf::Vector2i topLeft = target.mapCoordsToPixel(sf::Vector2f(rect.left, rect.top));
+        sf::Vector2i bottomRight = target.mapCoordsToPixel(sf::Vector2f(rect.left + rect.width, rect.top + rect.height));
+
+        // The coordinates were rounded to pixels, so be a bit generous at the edges
+        return m_ClippingStack.back().intersects(sf::IntRect(topLeft.x - 1, topLeft.y - 1, bottomRight.x - topLeft.x + 2, bottomRight.y - topLeft.y + 2));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::draw(sf::RenderTarget& target, const Texture& texture, const sf::RenderStates& states)
+    {
+        const sf::IntRect& textureRect = texture.sprite.getTextureRect();
+
+        // Only a repeated texture inside an atlas page needs special care, the other textures are just sprites
+        if (!texture.repeated || !texture.isInAtlas() || (textureRect.width <= 0) || (textureRect.height <= 0))
+        {
+            draw(target, texture.sprite, states);
+            return;
+        }
+
+        // The atlas page can't be repeated by OpenGL, so the image is drawn once for every time that it fits inside the texture rect
+        const sf::IntRect& imageRect = texture.data->atlasRect;
+        const sf::Transform transform = states.transform * texture.sprite.getTransform();
+
+        for (int y = 0; y < textureRect.height;)
+        {
+            int imageTop = ((((textureRect.top - imageRect.top + y) % imageRect.height) + imageRect.height) % imageRect.height);
+            int tileHeight = TGUI_MINIMUM(imageRect.height - imageTop, textureRect.height - y);
+
+            for (int x = 0; x < textureRect.width;)
+            {
+                int imageLeft = ((((textureRect.left - imageRect.left + x) % imageRect.width) + imageRect.width) % imageRect.width);
+                int tileWidth = TGUI_MINIMUM(imageRect.width - imageLeft, textureRect.width - x);
+
+                sf::IntRect tileRect(imageRect.left + imageLeft, imageRect.top + imageTop, tileWidth, tileHeight);
+
+                if (isBatching(target) && !states.shader)
+                {
+                    addQuad(transform,
+                            sf::FloatRect(static_cast<float>(x), static_cast<float>(y), static_cast<float>(tileWidth), static_cast<float>(tileHeight)),
+                            sf::FloatRect(tileRect),
+                            texture.sprite.getColor(),
+                            texture.sprite.getTexture(),
+                            states);
+                }
+                else
+                {
+                    sf::Sprite tile(*texture.sprite.getTexture(), tileRect);
+                    tile.setColor(texture.sprite.getColor());
+                    tile.setPosition(static_cast<float>(x), static_cast<float>(y));
+
+                    sf::RenderStates tileStates = states;
+                    tileStates.transform = transform;
+                    draw(target, tile, tileStates);
+                }
+
+                x += tileWidth;
+            }
+
+            y += tileHeight;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        // A sprite without a texture doesn't draw anything
+        if (sprite.getTexture() == nullptr)
+            return;
+
+        if (!isBatching(target))
+        {
+            target.draw(sprite, states);
+        }
+        else if (states.shader)
+        {
+            flush();
+            target.draw(sprite, states);
+            ++m_DrawCalls;
+        }
+        else
+        {
+            const sf::IntRect& textureRect = sprite.getTextureRect();
+
+            addQuad(states.transform * sprite.getTransform(),
+                    sf::FloatRect(0, 0, static_cast<float>(std::abs(textureRect.width)), static_cast<float>(std::abs(textureRect.height))),
+                    sf::FloatRect(textureRect),
+                    sprite.getColor(),
+                    sprite.getTexture(),
+                    states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::draw(sf::RenderTarget& target, const sf::RectangleShape& rectangle, const sf::RenderStates& states)
+    {
+        if (!isBatching(target))
+        {
+            target.draw(rectangle, states);
+        }
+        else if ((states.shader) || (rectangle.getTexture()) || (rectangle.getOutlineThickness() != 0))
+        {
+            flush();
+            target.draw(rectangle, states);
+            ++m_DrawCalls;
+        }
+        else
+        {
+            addQuad(states.transform * rectangle.getTransform(),
+                    sf::FloatRect(0, 0, rectangle.getSize().x, rectangle.getSize().y),
+                    sf::FloatRect(),
+                    rectangle.getFillColor(),
+                    nullptr,
+                    states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        if (isBatching(target))
+        {
+            // Everything that was drawn before has to end up below the drawable
+            flush();
+            target.draw(drawable, states);
+            ++m_DrawCalls;
+        }
+        else
+            target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::flush()
+    {
+        if (m_Vertices.getVertexCount() > 0)
+        {
+            m_Target->draw(m_Vertices, sf::RenderStates(m_BlendMode, sf::Transform::Identity, m_Texture, nullptr));
+            ++m_DrawCalls;
+
+            // Clearing the array doesn't release its memory, so the next batch doesn't need to allocate again
+            m_Vertices.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Renderer::getDrawCallCount() const
+    {
+        return m_DrawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Renderer::drawRenderTexture(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        if (!sf::Shader::isAvailable())
+            return false;
+
+        if (!m_UnpremultiplyShaderLoaded)
+        {
+            const std::string source =
+                "uniform sampler2D texture;"
+                "void main()"
+                "{"
+                "    vec4 color = texture2D(texture, gl_TexCoord[0].xy);"
+                "    if (color.a > 0.0)"
+                "        color.rgb /= color.a;"
+                "    gl_FragColor = gl_Color * color;"
+                "}";
+
+            if (!m_UnpremultiplyShader.loadFromMemory(source, sf::Shader::Fragment))
+                return false;
+
+            m_UnpremultiplyShader.setParameter("texture", sf::Shader::CurrentTexture);
+            m_UnpremultiplyShaderLoaded = true;
+        }
+
+        sf::RenderStates shaderStates = states;
+        shaderStates.shader = &m_UnpremultiplyShader;
+        draw(target, sprite, shaderStates);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Renderer::isBatching(const sf::RenderTarget& target) const
+    {
+        return m_Target == &target;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::addQuad(const sf::Transform& transform, const sf::FloatRect& rect, const sf::FloatRect& texCoords,
+                           const sf::Color& color, const sf::Texture* texture, const sf::RenderStates& states)
+    {
+        // The quads in one batch must all be drawn with the same texture and blend mode
+        if ((texture != m_Texture) || (states.blendMode != m_BlendMode))
+        {
+            flush();
+
+            m_Texture = texture;
+            m_BlendMode = states.blendMode;
+        }
+
+        // The transformation is applied here because the whole batch is drawn with an identity transform
+        m_Vertices.append(sf::Vertex(transform.transformPoint(rect.left, rect.top),
+                                     color, sf::Vector2f(texCoords.left, texCoords.top)));
+        m_Vertices.append(sf::Vertex(transform.transformPoint(rect.left + rect.width, rect.top),
+                                     color, sf::Vector2f(texCoords.left + texCoords.width, texCoords.top)));
+        m_Vertices.append(sf::Vertex(transform.transformPoint(rect.left + rect.width, rect.top + rect.height),
+                                     color, sf::Vector2f(texCoords.left + texCoords.width, texCoords.top + texCoords.height)));
+        m_Vertices.append(sf::Vertex(transform.transformPoint(rect.left, rect.top + rect.height),
+                                     color, sf::Vector2f(texCoords.left, texCoords.top + texCoords.height)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::applyClipping()
+    {
+        const sf::IntRect& clipping = m_ClippingStack.back();
+        if (clipping == m_AppliedClipping)
+            return;
+
+        // Everything that is waiting was meant to be drawn inside the old clipping area
+        flush();
+
+        glScissor(clipping.left, static_cast<GLint>(m_Target->getSize().y) - clipping.top - clipping.height, clipping.width, clipping.height);
+        m_AppliedClipping = clipping;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Renderer::activate(sf::RenderTarget* target)
+    {
+        if (sf::RenderWindow* window = dynamic_cast<sf::RenderWindow*>(target))
+            window->setActive(true);
+        else if (sf::RenderTexture* texture = dynamic_cast<sf::RenderTexture*>(target))
+            texture->setActive(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +153,8 @@ namespace tgui
 
     bool Scrollbar::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -407,6 +409,8 @@ namespace tgui
 
     void Scrollbar::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the scrollbar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -462,6 +466,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_Maximum = maximum;
@@ -479,6 +485,8 @@ namespace tgui
 
     void Scrollbar::setValue(unsigned int value)
     {
+        invalidate();
+
         if (m_Value != value)
         {
             // Set the new value
@@ -491,7 +499,7 @@ namespace tgui
                 m_Value = m_Maximum - m_LowValue;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -504,6 +512,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        invalidate();
+
         // Set the new value
         m_LowValue = lowValue;
 
@@ -518,6 +528,8 @@ namespace tgui
 
     void Scrollbar::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         // Only continue when the value changed
         if (m_VerticalScroll != verticalScroll)
         {
@@ -574,6 +586,8 @@ namespace tgui
 
     void Scrollbar::setArrowScrollAmount(unsigned int scrollAmount)
     {
+        invalidate();
+
         m_ScrollAmount = scrollAmount;
     }
 
@@ -588,6 +602,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
+
         m_AutoHide = autoHide;
     }
 
@@ -602,6 +618,8 @@ namespace tgui
 
     void Scrollbar::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureTrackNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -1075,7 +1093,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -1207,16 +1225,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
             else
-                target.draw(m_TextureTrackNormal_M, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal_M, states);
+            TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
         }
 
         // Reset the transformation (in case there was any rotation)
@@ -1235,16 +1253,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track height (height without the arrows)
@@ -1274,16 +1292,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbHover, states);
                 }
 
                 // Set the transformation of the second arrow
@@ -1300,16 +1318,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Change the position of the second arrow
@@ -1331,16 +1349,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track width (width without the arrows)
@@ -1370,16 +1388,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        TGUI_Renderer.draw(target, m_TextureThumbHover, states);
                 }
 
                 // Set the transformation of the second arrow
@@ -1400,16 +1418,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Set the translation of the second arrow
@@ -1421,16 +1439,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureArrowDownHover, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
             else
-                target.draw(m_TextureArrowDownNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureArrowDownNormal, states);
+            TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureArrowDownHover, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
         }
     }
 
@@ -133,6 +133,8 @@ namespace tgui
 
     bool Slider::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -293,7 +295,7 @@ namespace tgui
                 // Set the thumb size
                 m_ThumbSize = sf::Vector2f(m_TextureThumbNormal.getSize());
 
-                m_TextureTrackNormal_M.data->texture.setRepeated(true);
+                m_TextureTrackNormal_M.setRepeated(true);
             }
             else
             {
@@ -307,7 +309,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureTrackHover_M.data->texture.setRepeated(true);
+                m_TextureTrackHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -419,6 +421,8 @@ namespace tgui
 
     void Slider::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -445,8 +449,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
                 }
                 else
                 {
@@ -456,8 +460,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
                 }
             }
             else
@@ -470,8 +474,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
                 else
                 {
@@ -481,8 +485,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
             }
 
@@ -581,8 +585,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Slider::getBounds() const
+    {
+        return sf::FloatRect(getPosition().x - (m_ThumbSize.x * 0.5f), getPosition().y - (m_ThumbSize.y * 0.5f),
+                             m_Size.x + m_ThumbSize.x, m_Size.y + m_ThumbSize.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Slider::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -599,6 +613,8 @@ namespace tgui
 
     void Slider::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_Maximum = maximum;
@@ -618,6 +634,8 @@ namespace tgui
 
     void Slider::setValue(unsigned int value)
     {
+        invalidate();
+
         if (m_Value != value)
         {
             // Set the new value
@@ -630,7 +648,7 @@ namespace tgui
                 m_Value = m_Maximum;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -643,6 +661,8 @@ namespace tgui
 
     void Slider::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         // Only continue when the value changed
         if (m_VerticalScroll != verticalScroll)
         {
@@ -699,6 +719,8 @@ namespace tgui
 
     void Slider::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureTrackNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -931,7 +953,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -993,29 +1015,29 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureTrackNormal_L, states);
-                    target.draw(m_TextureTrackNormal_M, states);
-                    target.draw(m_TextureTrackNormal_R, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackNormal_L, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureTrackNormal_L, states);
-                target.draw(m_TextureTrackNormal_M, states);
-                target.draw(m_TextureTrackNormal_R, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal_L, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal_R, states);
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_L, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_R, states);
                 }
             }
         }
@@ -1038,18 +1060,18 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureTrackHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
                 else
-                    target.draw(m_TextureTrackNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
             }
             else
             {
                 // Draw the normal track image
-                target.draw(m_TextureTrackNormal_M, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal_M, states);
 
                 // When the mouse is on top of the slider then draw the hover image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureTrackHover_M, states);
+                    TGUI_Renderer.draw(target, m_TextureTrackHover_M, states);
             }
         }
 
@@ -1086,11 +1108,11 @@ namespace tgui
         }
 
         // Draw the normal thumb image
-        target.draw(m_TextureThumbNormal, states);
+        TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
 
         // When the mouse is on top of the slider then draw the hover image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureThumbHover, states);
+            TGUI_Renderer.draw(target, m_TextureThumbHover, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
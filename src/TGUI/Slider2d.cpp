@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Slider2d.hpp>
 
@@ -112,6 +110,8 @@ namespace tgui
 
     bool Slider2d::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -227,6 +227,8 @@ namespace tgui
 
     void Slider2d::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -244,6 +246,8 @@ namespace tgui
 
     void Slider2d::setMinimum(const sf::Vector2f& minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -264,6 +268,8 @@ namespace tgui
 
     void Slider2d::setMaximum(const sf::Vector2f& maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -284,6 +290,8 @@ namespace tgui
 
     void Slider2d::setValue(const sf::Vector2f& value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -324,6 +332,8 @@ namespace tgui
 
     void Slider2d::setFixedThumbSize(bool fixedSize)
     {
+        invalidate();
+
         m_FixedThumbSize = fixedSize;
     }
 
@@ -345,6 +355,8 @@ namespace tgui
 
     void Slider2d::centerThumb()
     {
+        invalidate();
+
         setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
     }
 
@@ -352,6 +364,8 @@ namespace tgui
 
     void Slider2d::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureThumbNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -380,7 +394,7 @@ namespace tgui
         {
             setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
 
-            if (m_CallbackFunctions[ThumbReturnedToCenter].empty() == false)
+            if (isCallbackBound(ThumbReturnedToCenter))
             {
                 m_Callback.trigger = ThumbReturnedToCenter;
                 m_Callback.value2d = m_Value;
@@ -428,7 +442,7 @@ namespace tgui
             setValue(m_Value);
 
             // Add the callback (if the user requested it)
-            if ((oldValue != m_Value) && (m_CallbackFunctions[ValueChanged].empty() == false))
+            if ((oldValue != m_Value) && (isCallbackBound(ValueChanged)))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value2d = m_Value;
@@ -457,7 +471,7 @@ namespace tgui
             {
                 setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
 
-                if (m_CallbackFunctions[ThumbReturnedToCenter].empty() == false)
+                if (isCallbackBound(ThumbReturnedToCenter))
                 {
                     m_Callback.trigger = ThumbReturnedToCenter;
                     m_Callback.value2d = m_Value;
@@ -605,9 +619,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(ThumbReturnedToCenter) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ThumbReturnedToCenter).size() == 1) && (m_CallbackFunctions.at(ThumbReturnedToCenter).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ThumbReturnedToCenter))
                 callbacks.push_back("ThumbReturnedToCenter");
 
             encodeList(callbacks, value);
@@ -646,18 +660,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -673,16 +675,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                TGUI_Renderer.draw(target, m_TextureTrackHover, states);
             else
-                target.draw(m_TextureTrackNormal, states);
+                TGUI_Renderer.draw(target, m_TextureTrackNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal, states);
+            TGUI_Renderer.draw(target, m_TextureTrackNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                TGUI_Renderer.draw(target, m_TextureTrackHover, states);
         }
 
         // Undo the scale
@@ -703,43 +705,27 @@ namespace tgui
             states.transform.scale(scaling);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
-
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Don't let the thumb be drawn outside the track
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
         // Draw the thumb image
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                TGUI_Renderer.draw(target, m_TextureThumbHover, states);
             else
-                target.draw(m_TextureThumbNormal, states);
+                TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureThumbNormal, states);
+            TGUI_Renderer.draw(target, m_TextureThumbNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                TGUI_Renderer.draw(target, m_TextureThumbHover, states);
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +111,8 @@ namespace tgui
 
     bool SpinButton::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -226,6 +228,8 @@ namespace tgui
 
     void SpinButton::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the spin button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -243,6 +247,8 @@ namespace tgui
 
     void SpinButton::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -259,6 +265,8 @@ namespace tgui
 
     void SpinButton::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         m_Maximum = maximum;
 
         // The maximum can never be below the minimum
@@ -274,6 +282,8 @@ namespace tgui
 
     void SpinButton::setValue(unsigned int value)
     {
+        invalidate();
+
         // Set the new value
         m_Value = value;
 
@@ -309,6 +319,8 @@ namespace tgui
 
     void SpinButton::setVerticalScroll(bool verticalScroll)
     {
+        invalidate();
+
         m_VerticalScroll = verticalScroll;
     }
 
@@ -323,6 +335,8 @@ namespace tgui
 
     void SpinButton::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureArrowUpNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -396,7 +410,7 @@ namespace tgui
             }
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -409,6 +423,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(float x, float y)
     {
+        const bool mouseHoverOnTopArrow = m_MouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_VerticalScroll)
         {
@@ -425,6 +441,10 @@ namespace tgui
                 m_MouseHoverOnTopArrow = true;
         }
 
+        // The hover image moves to the other arrow
+        if (m_MouseHoverOnTopArrow != mouseHoverOnTopArrow)
+            invalidate();
+
         if (m_MouseHover == false)
             mouseEnteredWidget();
 
@@ -513,7 +533,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -565,19 +585,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -590,19 +610,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
                 }
             }
         }
@@ -622,19 +642,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -647,19 +667,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                TGUI_Renderer.draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        TGUI_Renderer.draw(target, m_TextureArrowDownHover, states);
                 }
             }
         }
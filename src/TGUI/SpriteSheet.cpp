@@ -78,6 +78,8 @@ namespace tgui
 
     void SpriteSheet::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -87,7 +89,7 @@ namespace tgui
         m_Size.y = height;
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +106,8 @@ namespace tgui
 
     void SpriteSheet::setCells(unsigned int rows, unsigned int columns)
     {
+        invalidate();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -121,19 +125,21 @@ namespace tgui
         m_Columns = columns;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SpriteSheet::setRows(unsigned int rows)
     {
+        invalidate();
+
         setCells(rows, m_Columns);
     }
 
@@ -148,6 +154,8 @@ namespace tgui
 
     void SpriteSheet::setColumns(unsigned int columns)
     {
+        invalidate();
+
         setCells(m_Rows, columns);
     }
 
@@ -162,6 +170,8 @@ namespace tgui
 
     void SpriteSheet::setVisibleCell(unsigned int row, unsigned int column)
     {
+        invalidate();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -183,10 +193,10 @@ namespace tgui
         m_VisibleCell.y = row;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Tab.hpp>
 
@@ -133,6 +131,8 @@ namespace tgui
 
     bool Tab::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -278,7 +278,7 @@ namespace tgui
             {
                 m_TabHeight = m_TextureNormal_M.getSize().y;
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -291,7 +291,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Selected;
 
-                m_TextureSelected_M.data->texture.setRepeated(true);
+                m_TextureSelected_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -332,6 +332,7 @@ namespace tgui
 
     void Tab::setSize(float, float)
     {
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,12 +361,13 @@ namespace tgui
 
     unsigned int Tab::add(const sf::String& name, bool selectTab)
     {
+        invalidateBounds();
+
         // Add the tab
         m_TabNames.push_back(name);
 
         // Calculate the width of the tab
-        m_Text.setString(name);
-        m_NameWidth.push_back(m_Text.getLocalBounds().width);
+        m_NameWidth.push_back(getNameWidth(name));
 
         // If the tab has to be selected then do so
         if (selectTab)
@@ -379,6 +381,8 @@ namespace tgui
 
     void Tab::select(const sf::String& name)
     {
+        invalidate();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -398,6 +402,8 @@ namespace tgui
 
     void Tab::select(unsigned int index)
     {
+        invalidate();
+
         // If the index is too big then do nothing
         if (index > m_TabNames.size()-1)
         {
@@ -413,6 +419,8 @@ namespace tgui
 
     void Tab::deselect()
     {
+        invalidate();
+
         m_SelectedTab = -1;
     }
 
@@ -420,6 +428,8 @@ namespace tgui
 
     void Tab::remove(const sf::String& name)
     {
+        invalidateBounds();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -447,6 +457,8 @@ namespace tgui
 
     void Tab::remove(unsigned int index)
     {
+        invalidateBounds();
+
         // The index can't be too high
         if (index > m_TabNames.size()-1)
         {
@@ -469,6 +481,8 @@ namespace tgui
 
     void Tab::removeAll()
     {
+        invalidateBounds();
+
         m_TabNames.clear();
         m_NameWidth.clear();
         m_SelectedTab = -1;
@@ -495,6 +509,8 @@ namespace tgui
 
     void Tab::setTextFont(const sf::Font& font)
     {
+        invalidateBounds();
+
         m_Text.setFont(font);
     }
 
@@ -509,6 +525,8 @@ namespace tgui
 
     void Tab::setTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_TextColor = color;
     }
 
@@ -523,6 +541,8 @@ namespace tgui
 
     void Tab::setSelectedTextColor(const sf::Color& color)
     {
+        invalidate();
+
         m_SelectedTextColor = color;
     }
 
@@ -537,6 +557,8 @@ namespace tgui
 
     void Tab::setTextSize(unsigned int size)
     {
+        invalidateBounds();
+
         // Change the text size
         m_TextSize = size;
 
@@ -555,10 +577,7 @@ namespace tgui
 
         // Recalculate the name widths
         for (unsigned int i=0; i<m_NameWidth.size(); ++i)
-        {
-            m_Text.setString(m_TabNames[i]);
-            m_NameWidth[i] = m_Text.getLocalBounds().width;
-        }
+            m_NameWidth[i] = getNameWidth(m_TabNames[i]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,6 +591,8 @@ namespace tgui
 
     void Tab::setTabHeight(unsigned int height)
     {
+        invalidateBounds();
+
         // Make sure that the height changed
         if (m_TabHeight != height)
         {
@@ -594,6 +615,8 @@ namespace tgui
 
     void Tab::setMaximumTabWidth(unsigned int maximumWidth)
     {
+        invalidateBounds();
+
         m_MaximumTabWidth = maximumWidth;
     }
 
@@ -608,6 +631,8 @@ namespace tgui
 
     void Tab::setDistanceToSide(unsigned int distanceToSide)
     {
+        invalidateBounds();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -622,6 +647,8 @@ namespace tgui
 
     void Tab::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         m_TextureNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -654,6 +681,8 @@ namespace tgui
 
     void Tab::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         float width = getPosition().x;
 
         // Loop through all tabs
@@ -673,7 +702,7 @@ namespace tgui
                 m_SelectedTab = i;
 
                 // Add the callback (if the user requested it)
-                if (m_CallbackFunctions[TabChanged].empty() == false)
+                if (isCallbackBound(TabChanged))
                 {
                     m_Callback.trigger = TabChanged;
                     m_Callback.value   = m_SelectedTab;
@@ -782,7 +811,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TabChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TabChanged).size() == 1) && (m_CallbackFunctions.at(TabChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(TabChanged))
                 callbacks.push_back("TabChanged");
 
             encodeList(callbacks, value);
@@ -825,21 +854,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Tab::getNameWidth(const sf::String& name) const
+    {
+        if (m_Text.getFont() == nullptr)
+            return 0;
+
+        // The bounds of the drawn text are used (and not the advances of the characters), so that the tabs keep their size
+        sf::Text text(name, *m_Text.getFont(), m_Text.getCharacterSize());
+        return text.getLocalBounds().width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Tab::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw when the child window wasn't created
         if (m_Loaded == false)
             return;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         // Apply the transformations
         states.transform *= getTransform();
 
@@ -891,16 +923,16 @@ namespace tgui
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
+                        TGUI_Renderer.draw(target, m_TextureSelected_L, states);
                     else
-                        target.draw(m_TextureNormal_L, states);
+                        TGUI_Renderer.draw(target, m_TextureNormal_L, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_L, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_L, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
+                        TGUI_Renderer.draw(target, m_TextureSelected_L, states);
                 }
 
                 // Check if the middle image may be drawn
@@ -919,16 +951,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_M, states);
                         else
-                            target.draw(m_TextureNormal_M, states);
+                            TGUI_Renderer.draw(target, m_TextureNormal_M, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_M, states);
+                        TGUI_Renderer.draw(target, m_TextureNormal_M, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_M, states);
                     }
 
                     // Put the right image on the correct position
@@ -941,16 +973,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_R, states);
                         else
-                            target.draw(m_TextureNormal_R, states);
+                            TGUI_Renderer.draw(target, m_TextureNormal_R, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_R, states);
+                        TGUI_Renderer.draw(target, m_TextureNormal_R, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_R, states);
                     }
 
                     // Undo the translation
@@ -965,16 +997,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_R, states);
                         else
-                            target.draw(m_TextureNormal_R, states);
+                            TGUI_Renderer.draw(target, m_TextureNormal_R, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_R, states);
+                        TGUI_Renderer.draw(target, m_TextureNormal_R, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            TGUI_Renderer.draw(target, m_TextureSelected_R, states);
                     }
 
                     // Undo the translation
@@ -993,16 +1025,16 @@ namespace tgui
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        TGUI_Renderer.draw(target, m_TextureSelected_M, states);
                     else
-                        target.draw(m_TextureNormal_M, states);
+                        TGUI_Renderer.draw(target, m_TextureNormal_M, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    TGUI_Renderer.draw(target, m_TextureNormal_M, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        TGUI_Renderer.draw(target, m_TextureSelected_M, states);
                 }
 
                 // Undo the scaling
@@ -1034,30 +1066,13 @@ namespace tgui
                 // Check if clipping is required for this text
                 if (clippingRequired)
                 {
-                    // Get the global position
-                    sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x + accumulatedTabWidth + m_DistanceToSide + (view.getSize().x / 2.f) - view.getCenter().x) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                                ((getAbsolutePosition().y + (view.getSize().y / 2.f) - view.getCenter().y) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-                    sf::Vector2f bottomRightPosition = sf::Vector2f(((getAbsolutePosition().x + accumulatedTabWidth + tabWidth - m_DistanceToSide - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                                    ((getAbsolutePosition().y + ((m_TabHeight + defaultRect.height) / 2.f) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-
-                    // Calculate the clipping area
-                    GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                    GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                    GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                    GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                    // If the widget outside the window then don't draw anything
-                    if (scissorRight < scissorLeft)
-                        scissorRight = scissorLeft;
-                    else if (scissorBottom < scissorTop)
-                        scissorTop = scissorBottom;
-
-                    // Set the clipping area
-                    glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                    // Don't let the text go outside the tab
+                    TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x + accumulatedTabWidth + m_DistanceToSide, getAbsolutePosition().y,
+                                                                      tabWidth - (2.f * m_DistanceToSide), (m_TabHeight + defaultRect.height) / 2.f));
                 }
 
                 // Draw the text
-                target.draw(tempText, states);
+                TGUI_Renderer.draw(target, tempText, states);
 
                 // Undo the translation of the text
                 states.transform.translate(-std::floor(realRect.left + 0.5f), -std::floor(realRect.top + 0.5f));
@@ -1066,7 +1081,7 @@ namespace tgui
                 if (clippingRequired)
                 {
                     clippingRequired = false;
-                    glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                    TGUI_Renderer.popClipping();
                 }
             }
 
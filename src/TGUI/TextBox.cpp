@@ -23,7 +23,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <fstream>
 
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
@@ -34,15 +35,24 @@
 
 namespace tgui
 {
+    // The amount of bytes that is read from a file at once when loading a text
+    static const std::size_t loadBlockSize = 64 * 1024;
+
+    // The amount of characters of a loaded text that is wrapped during every update, until all lines are known
+    static const std::size_t charactersWrappedPerUpdate = 100 * 1024;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox() :
     m_Size                    (360, 200),
     m_Text                    (""),
-    m_DisplayedText           (""),
+    m_TextFont                (nullptr),
     m_TextSize                (30),
     m_LineHeight              (40),
     m_Lines                   (1),
+    m_LineStarts              (1, 0),
+    m_LineStartsWidth         (-1),
+    m_LineStartsComplete      (true),
     m_MaxChars                (0),
     m_TopLine                 (1),
     m_VisibleLines            (1),
@@ -59,7 +69,6 @@ namespace tgui
     m_readOnly                (false)
     {
         m_Callback.widgetType = Type_TextBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
 
         changeColors();
@@ -76,10 +85,13 @@ namespace tgui
     m_LoadedConfigFile           (copy.m_LoadedConfigFile),
     m_Size                       (copy.m_Size),
     m_Text                       (copy.m_Text),
-    m_DisplayedText              (copy.m_DisplayedText),
+    m_TextFont                   (copy.m_TextFont),
     m_TextSize                   (copy.m_TextSize),
     m_LineHeight                 (copy.m_LineHeight),
     m_Lines                      (copy.m_Lines),
+    m_LineStarts                 (copy.m_LineStarts),
+    m_LineStartsWidth            (copy.m_LineStartsWidth),
+    m_LineStartsComplete         (copy.m_LineStartsComplete),
     m_MaxChars                   (copy.m_MaxChars),
     m_TopLine                    (copy.m_TopLine),
     m_VisibleLines               (copy.m_VisibleLines),
@@ -92,14 +104,13 @@ namespace tgui
     m_SelectionPointWidth        (copy.m_SelectionPointWidth),
     m_SelectionTextsNeedUpdate   (copy.m_SelectionTextsNeedUpdate),
     m_BackgroundColor            (copy.m_BackgroundColor),
+    m_TextColor                  (copy.m_TextColor),
+    m_SelectedTextColor          (copy.m_SelectedTextColor),
     m_SelectedTextBgrColor       (copy.m_SelectedTextBgrColor),
     m_BorderColor                (copy.m_BorderColor),
-    m_TextBeforeSelection        (copy.m_TextBeforeSelection),
-    m_TextSelection1             (copy.m_TextSelection1),
-    m_TextSelection2             (copy.m_TextSelection2),
-    m_TextAfterSelection1        (copy.m_TextAfterSelection1),
-    m_TextAfterSelection2        (copy.m_TextAfterSelection2),
-    m_MultilineSelectionRectWidth(copy.m_MultilineSelectionRectWidth),
+    m_LineTexts                  (copy.m_LineTexts),
+    m_SelectionRects             (copy.m_SelectionRects),
+    m_TextShift                  (copy.m_TextShift),
     m_PossibleDoubleClick        (copy.m_PossibleDoubleClick),
     m_readOnly                   (copy.m_readOnly)
     {
@@ -138,10 +149,13 @@ namespace tgui
             std::swap(m_LoadedConfigFile,            temp.m_LoadedConfigFile);
             std::swap(m_Size,                        temp.m_Size);
             std::swap(m_Text,                        temp.m_Text);
-            std::swap(m_DisplayedText,               temp.m_DisplayedText);
+            std::swap(m_TextFont,                    temp.m_TextFont);
             std::swap(m_TextSize,                    temp.m_TextSize);
             std::swap(m_LineHeight,                  temp.m_LineHeight);
             std::swap(m_Lines,                       temp.m_Lines);
+            std::swap(m_LineStarts,                  temp.m_LineStarts);
+            std::swap(m_LineStartsWidth,             temp.m_LineStartsWidth);
+            std::swap(m_LineStartsComplete,          temp.m_LineStartsComplete);
             std::swap(m_MaxChars,                    temp.m_MaxChars);
             std::swap(m_TopLine,                     temp.m_TopLine);
             std::swap(m_VisibleLines,                temp.m_VisibleLines);
@@ -154,14 +168,13 @@ namespace tgui
             std::swap(m_SelectionPointWidth,         temp.m_SelectionPointWidth);
             std::swap(m_SelectionTextsNeedUpdate,    temp.m_SelectionTextsNeedUpdate);
             std::swap(m_BackgroundColor,             temp.m_BackgroundColor);
+            std::swap(m_TextColor,                   temp.m_TextColor);
+            std::swap(m_SelectedTextColor,           temp.m_SelectedTextColor);
             std::swap(m_SelectedTextBgrColor,        temp.m_SelectedTextBgrColor);
             std::swap(m_BorderColor,                 temp.m_BorderColor);
-            std::swap(m_TextBeforeSelection,         temp.m_TextBeforeSelection);
-            std::swap(m_TextSelection1,              temp.m_TextSelection1);
-            std::swap(m_TextSelection2,              temp.m_TextSelection2);
-            std::swap(m_TextAfterSelection1,         temp.m_TextAfterSelection1);
-            std::swap(m_TextAfterSelection2,         temp.m_TextAfterSelection2);
-            std::swap(m_MultilineSelectionRectWidth, temp.m_MultilineSelectionRectWidth);
+            std::swap(m_LineTexts,                   temp.m_LineTexts);
+            std::swap(m_SelectionRects,              temp.m_SelectionRects);
+            std::swap(m_TextShift,                   temp.m_TextShift);
             std::swap(m_Scroll,                      temp.m_Scroll);
             std::swap(m_PossibleDoubleClick,         temp.m_PossibleDoubleClick);
             std::swap(m_readOnly,                    temp.m_readOnly);
@@ -181,6 +194,8 @@ namespace tgui
 
     bool TextBox::load(const std::string& configFileFilename)
     {
+        invalidateBounds();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -296,6 +311,8 @@ namespace tgui
 
     void TextBox::setSize(float width, float height)
     {
+        invalidateBounds();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -376,14 +393,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect TextBox::getBounds() const
+    {
+        // The borders are drawn outside the text box
+        return sf::FloatRect(getPosition().x - m_LeftBorder, getPosition().y - m_TopBorder, getFullSize().x, getFullSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
         // Store the text
         m_Text = text;
+        m_LineStartsComplete = true;
+        updateLineStarts();
 
         // Set the selection point behind the last character
         setSelectionPointPosition(m_Text.getSize());
@@ -393,12 +422,14 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
         // Add the text
-        m_Text += text;
+        insertText(m_Text.getSize(), text);
 
         // Set the selection point behind the last character
         setSelectionPointPosition(m_Text.getSize());
@@ -408,31 +439,129 @@ namespace tgui
 
     sf::String TextBox::getText() const
     {
-        return m_Text;
+        return m_Text.getString();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::loadTextFromFile(const std::string& filename)
+    {
+        invalidate();
+
+        // Don't do anything when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return false;
+
+        std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open " + filename + ".");
+            return false;
+        }
+
+        m_Text.clear();
+
+        // Read the file a block at a time. The bytes of a character that was cut off at the end of a block are moved to the
+        // front of the block, so that they are decoded together with the rest of the character.
+        std::vector<char> block(loadBlockSize);
+        std::size_t leftoverBytes = 0;
+        bool firstBlock = true;
+        while (true)
+        {
+            file.read(&block[leftoverBytes], block.size() - leftoverBytes);
+            const std::size_t blockSize = leftoverBytes + static_cast<std::size_t>(file.gcount());
+            if (blockSize == 0)
+                break;
+
+            const char* begin = &block[0];
+            const char* end = begin + blockSize;
+
+            // Search the start of the last character, which is at most 4 bytes away from the end
+            const char* decodeEnd = end;
+            if (file)
+            {
+                const char* lastCharacter = end - 1;
+                while ((lastCharacter > begin) && (lastCharacter > end - 4) && ((*lastCharacter & 0xC0) == 0x80))
+                    --lastCharacter;
+
+                const unsigned char leadByte = static_cast<unsigned char>(*lastCharacter);
+                const std::ptrdiff_t characterSize = (leadByte >= 0xF0) ? 4 : (leadByte >= 0xE0) ? 3 : (leadByte >= 0xC0) ? 2 : 1;
+                if (end - lastCharacter < characterSize)
+                    decodeEnd = lastCharacter;
+            }
+
+            // Skip the byte order mark at the start of the file
+            if (firstBlock && (decodeEnd - begin >= 3) && (begin[0] == '\xEF') && (begin[1] == '\xBB') && (begin[2] == '\xBF'))
+                begin += 3;
+
+            appendUtf8Text(begin, decodeEnd);
+
+            leftoverBytes = end - decodeEnd;
+            std::copy(decodeEnd, end, block.begin());
+            firstBlock = false;
+
+            // Stop when the end of the file was reached
+            if (!file)
+                break;
+        }
+
+        finishLoadingText();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::loadTextFromMemory(const void* data, std::size_t sizeInBytes)
+    {
+        invalidate();
+
+        // Don't do anything when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return;
+
+        const char* begin = static_cast<const char*>(data);
+        const char* end = begin + sizeInBytes;
+
+        // Skip the byte order mark at the start of the data
+        if ((sizeInBytes >= 3) && (begin[0] == '\xEF') && (begin[1] == '\xBB') && (begin[2] == '\xBF'))
+            begin += 3;
+
+        m_Text.clear();
+        appendUtf8Text(begin, end);
+
+        finishLoadingText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setTextFont(const sf::Font& font)
     {
-        m_TextBeforeSelection.setFont(font);
-        m_TextSelection1.setFont(font);
-        m_TextSelection2.setFont(font);
-        m_TextAfterSelection1.setFont(font);
-        m_TextAfterSelection2.setFont(font);
+        invalidate();
+
+        // The font may have been reloaded, or it may be a new font at the address of a destroyed one
+        TGUI_TextMetrics.removeFont(font);
+
+        m_TextFont = &font;
+
+        // The characters may have a different width in the new font
+        updateLineStarts();
+        m_SelectionTextsNeedUpdate = true;
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Font* TextBox::getTextFont() const
     {
-        return m_TextBeforeSelection.getFont();
+        return m_TextFont;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -440,18 +569,14 @@ namespace tgui
         if (m_TextSize < 8)
             m_TextSize = 8;
 
-        // Change the text size
-        m_TextBeforeSelection.setCharacterSize(m_TextSize);
-        m_TextSelection1.setCharacterSize(m_TextSize);
-        m_TextSelection2.setCharacterSize(m_TextSize);
-        m_TextAfterSelection1.setCharacterSize(m_TextSize);
-        m_TextAfterSelection2.setCharacterSize(m_TextSize);
+        // The lines have to be wrapped again
+        updateLineStarts();
 
-        if (!m_TextBeforeSelection.getFont())
+        if (!m_TextFont)
             return;
 
         // Calculate the height of one line
-        m_LineHeight = m_TextBeforeSelection.getFont()->getLineSpacing(m_TextSize);
+        m_LineHeight = m_TextFont->getLineSpacing(m_TextSize);
 
         // There is also a minimum height
         if (m_Size.y < m_LineHeight)
@@ -480,6 +605,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -487,7 +614,7 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_Text.getSize() > m_MaxChars))
         {
             // Remove all the excess characters
-            m_Text.erase(m_MaxChars, sf::String::InvalidPos);
+            eraseText(m_MaxChars, sf::String::InvalidPos);
 
             // Set the selection point behind the last character
             setSelectionPointPosition(m_Text.getSize());
@@ -505,6 +632,8 @@ namespace tgui
 
     void TextBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        invalidateBounds();
+
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
@@ -520,22 +649,24 @@ namespace tgui
                                const sf::Color& borderColor,
                                const sf::Color& selectionPointColor)
     {
-        m_TextBeforeSelection.setColor(color);
-        m_TextSelection1.setColor(selectedColor);
-        m_TextSelection2.setColor(selectedColor);
-        m_TextAfterSelection1.setColor(color);
-        m_TextAfterSelection2.setColor(color);
+        invalidate();
 
+        m_TextColor                     = color;
+        m_SelectedTextColor             = selectedColor;
         m_SelectionPointColor           = selectionPointColor;
         m_BackgroundColor               = backgroundColor;
         m_SelectedTextBgrColor          = selectedBgrColor;
         m_BorderColor                   = borderColor;
+
+        updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        invalidate();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -543,23 +674,30 @@ namespace tgui
 
     void TextBox::setTextColor(const sf::Color& textColor)
     {
-        m_TextBeforeSelection.setColor(textColor);
-        m_TextAfterSelection1.setColor(textColor);
-        m_TextAfterSelection2.setColor(textColor);
+        invalidate();
+
+        m_TextColor = textColor;
+
+        updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
-        m_TextSelection1.setColor(selectedTextColor);
-        m_TextSelection2.setColor(selectedTextColor);
+        invalidate();
+
+        m_SelectedTextColor = selectedTextColor;
+
+        updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        invalidate();
+
         m_SelectedTextBgrColor = selectedTextBackgroundColor;
     }
 
@@ -567,6 +705,8 @@ namespace tgui
 
     void TextBox::setBorderColor(const sf::Color& borderColor)
     {
+        invalidate();
+
         m_BorderColor = borderColor;
     }
 
@@ -574,6 +714,8 @@ namespace tgui
 
     void TextBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        invalidate();
+
         m_SelectionPointColor = selectionPointColor;
     }
 
@@ -588,14 +730,14 @@ namespace tgui
 
     const sf::Color& TextBox::getTextColor() const
     {
-        return m_TextBeforeSelection.getColor();
+        return m_TextColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Color& TextBox::getSelectedTextColor() const
     {
-        return m_TextSelection1.getColor();
+        return m_SelectedTextColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -623,6 +765,8 @@ namespace tgui
 
     void TextBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        invalidate();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -636,74 +780,20 @@ namespace tgui
         m_SelStart = charactersBeforeSelectionPoint;
         m_SelEnd = charactersBeforeSelectionPoint;
 
-        // Change our three texts
-        m_TextBeforeSelection.setString(m_DisplayedText);
-        m_TextSelection1.setString("");
-        m_TextSelection2.setString("");
-        m_TextAfterSelection1.setString("");
-        m_TextAfterSelection2.setString("");
-
         // Update the text
+        m_SelectionTextsNeedUpdate = true;
         updateDisplayedText();
 
-        // Check if there is a scrollbar
-        if (m_Scroll != nullptr)
-        {
-            unsigned int newlines = 0;
-            unsigned int newlinesAdded = 0;
-            unsigned int totalLines = 0;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        ++totalLines;
-
-                        if (i < m_SelEnd)
-                            ++newlines;
-                    }
-                }
-                else // The text already contains a newline
-                {
-                    ++totalLines;
-
-                    if (i < m_SelEnd)
-                        ++newlines;
-                }
-            }
-
-            // Check if the selection point is located above the view
-            if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
-            {
-                m_Scroll->setValue(newlines * m_LineHeight);
-                updateDisplayedText();
-            }
-
-            // Check if the selection point is below the view
-            else if (newlines > m_TopLine + m_VisibleLines - 2)
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                updateDisplayedText();
-            }
-            else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                updateDisplayedText();
-            }
-        }
+        // Make sure that the selection point is visible
+        scrollToSelectionPoint();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool TextBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        invalidate();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -738,17 +828,25 @@ namespace tgui
 
     void TextBox::removeScrollbar()
     {
+        invalidate();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
 
         m_TopLine = 1;
+
+        // The text is no longer scrolled
+        m_SelectionTextsNeedUpdate = true;
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setSelectionPointWidth(unsigned int width)
     {
+        invalidate();
+
         m_SelectionPointWidth = width;
     }
 
@@ -763,6 +861,8 @@ namespace tgui
 
     void TextBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -770,6 +870,8 @@ namespace tgui
 
     void TextBox::setTransparency(unsigned char transparency)
     {
+        invalidate();
+
         Widget::setTransparency(transparency);
 
         if (m_Scroll != nullptr)
@@ -817,6 +919,8 @@ namespace tgui
 
     void TextBox::leftMousePressed(float x, float y)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -848,7 +952,10 @@ namespace tgui
 
             // If the value of the scrollbar has changed then update the text
             if (oldValue != m_Scroll->getValue())
+            {
+                m_SelectionTextsNeedUpdate = true;
                 updateDisplayedText();
+            }
         }
 
         // If the click occured on the text box
@@ -875,58 +982,8 @@ namespace tgui
                 m_SelectionTextsNeedUpdate = true;
                 updateDisplayedText();
 
-                // Check if there is a scrollbar
-                if (m_Scroll != nullptr)
-                {
-                    unsigned int newlines = 0;
-                    unsigned int newlinesAdded = 0;
-                    unsigned int totalLines = 0;
-
-                    // Loop through all characters
-                    for (unsigned int i=0; i<m_SelEnd; ++i)
-                    {
-                        // Make sure there is no newline in the text
-                        if (m_Text[i] != '\n')
-                        {
-                            // Check if there is a newline in the displayed text
-                            if (m_DisplayedText[i + newlinesAdded] == '\n')
-                            {
-                                // A newline was added here
-                                ++newlinesAdded;
-                                ++totalLines;
-
-                                if (i < m_SelEnd)
-                                    ++newlines;
-                            }
-                        }
-                        else // The text already contains a newline
-                        {
-                            ++totalLines;
-
-                            if (i < m_SelEnd)
-                                ++newlines;
-                        }
-                    }
-
-                    // Check if the selection point is located above the view
-                    if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
-                    {
-                        m_Scroll->setValue(newlines * m_LineHeight);
-                        updateDisplayedText();
-                    }
-
-                    // Check if the selection point is below the view
-                    else if (newlines > m_TopLine + m_VisibleLines - 2)
-                    {
-                        m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                        updateDisplayedText();
-                    }
-                    else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
-                    {
-                        m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                        updateDisplayedText();
-                    }
-                }
+                // Make sure that the selection point is visible
+                scrollToSelectionPoint();
             }
             else // No double clicking
             {
@@ -939,7 +996,7 @@ namespace tgui
 
             // The selection point should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
     }
 
@@ -947,6 +1004,8 @@ namespace tgui
 
     void TextBox::leftMouseReleased(float x, float y)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -976,8 +1035,6 @@ namespace tgui
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_Scroll->getValue())
                 {
-                    updateDisplayedText();
-
                     // Check if the scrollbar value was incremented (you have pressed on the down arrow)
                     if (m_Scroll->getValue() == oldValue + 1)
                     {
@@ -998,6 +1055,9 @@ namespace tgui
                         else
                             m_Scroll->setValue(m_Scroll->getValue() - m_LineHeight);
                     }
+
+                    m_SelectionTextsNeedUpdate = true;
+                    updateDisplayedText();
                 }
             }
         }
@@ -1039,14 +1099,24 @@ namespace tgui
 
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_Scroll->getValue())
+                {
+                    invalidate();
+                    m_SelectionTextsNeedUpdate = true;
                     updateDisplayedText();
+                }
             }
             else // You are just moving the mouse
             {
+                const bool scrollbarHovered = m_Scroll->m_MouseHover;
+
                 // When the mouse is on top of the scrollbar then pass the mouse move event
                 if (m_Scroll->mouseOnWidget(x, y))
                     m_Scroll->mouseMoved(x, y);
 
+                // The scrollbar looks different while the mouse is on top of it
+                if (m_Scroll->m_MouseHover != scrollbarHovered)
+                    invalidate();
+
                 // If the mouse is down then you are selecting text
                 if (m_MouseDown)
                     selectText(x, y);
@@ -1090,6 +1160,8 @@ namespace tgui
 
     void TextBox::keyPressed(const sf::Event::KeyEvent& event)
     {
+        invalidate();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -1118,7 +1190,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Right)
         {
@@ -1143,199 +1215,31 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Up)
         {
-            sf::Text tempText(m_TextBeforeSelection);
-            tempText.setString(m_DisplayedText);
-
-            bool newlineAdded = false;
-            unsigned int newlinesAdded = 0;
-
-            unsigned int character;
-            unsigned int newTopPosition = 0;
-            sf::Vector2u newPosition(0, 0);
-
-            int distanceX;
-            unsigned int previousdistanceX = m_Size.x;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        newlineAdded = true;
-                    }
-                }
-                else // The newline occurs in the text itself
-                    newlineAdded = false;
-            }
-
-            // Get the position of the character behind the selection point
-            sf::Vector2u originalPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAdded));
-
-            // Try to find the line above the selection point
-            for (character=m_SelEnd; character > 0; --character)
-            {
-                // Get the top position of the character before it
-                newTopPosition = static_cast<unsigned int>(tempText.findCharacterPos(character + newlinesAdded - 1).y);
-
-                // Check if the the character is on the line above the original one
-                if (newTopPosition < originalPosition.y)
-                    break;
-            }
+            unsigned int line = findLineOfCharacter(m_SelEnd);
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Don't do anything when the selection point is on the first line
-            if (character > 0)
-            {
-                // Try to find the closest character
-                for ( ; character > 0; --character)
-                {
-                    // Get the position of the character before it
-                    newPosition = sf::Vector2u(tempText.findCharacterPos(character + newlinesAdded - 1));
-
-                    // The character must remain on the same line
-                    if (newPosition.y < newTopPosition)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character + newlineAdded);
-                        return;
-                    }
-
-                    // Calculate the distance to the original position
-                    distanceX = newPosition.x - originalPosition.x;
-
-                    // Check if the distance is going away again
-                    if (static_cast<unsigned int>(abs(distanceX)) > previousdistanceX)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character + newlineAdded);
-                        return;
-                    }
-
-                    // Remember the previous distance
-                    previousdistanceX = abs(distanceX);
-                }
-
-                // Check if the selection point should be behind the first character
-                if (originalPosition.x > previousdistanceX)
-                {
-                    // We have found the character that we were looking for
-                    setSelectionPointPosition(character + newlineAdded);
-                    return;
-                }
-
-                // If you pass here then the selection point should be at the beginning of the text
-                setSelectionPointPosition(0);
-            }
+            if (line > 0)
+                setSelectionPointPosition(findCharacterOnLine(line - 1, findCharacterPosition(m_SelEnd).x));
         }
         else if (event.code == sf::Keyboard::Down)
         {
-            sf::Text tempText(m_TextBeforeSelection);
-            tempText.setString(m_DisplayedText);
-
-            bool newlineAdded = false;
-            unsigned int newlinesAdded = 0;
-
-            unsigned int character;
-            unsigned int newTopPosition = 0;
-            sf::Vector2u newPosition(0, 0);
-
-            int distanceX;
-            int previousdistanceX = m_Size.x;
-
-            // Loop through all characters
-            for (unsigned int i=0; i<m_Text.getSize(); ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        newlineAdded = true;
-
-                        // Stop when the newline behind the selection point was found
-                        if (i > m_SelEnd)
-                            break;
-                    }
-                }
-                else // The newline occurs in the text itself
-                {
-                    newlineAdded = false;
-
-                    // Stop when the newline behind the selection point was found
-                    if (i > m_SelEnd)
-                        break;
-                }
-            }
-
-            // Get the position of the character behind the selection point
-            sf::Vector2u originalPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAdded - newlineAdded));
-
-            // Try to find the line below the selection point
-            for (character=m_SelEnd; character < m_Text.getSize(); ++character)
-            {
-                // Get the top position of the character after it
-                newTopPosition = static_cast<unsigned int>(tempText.findCharacterPos(character + newlinesAdded - newlineAdded + 1).y);
-
-                // Check if the the character is on the line below the original one
-                if (newTopPosition > originalPosition.y)
-                    break;
-            }
+            unsigned int line = findLineOfCharacter(m_SelEnd);
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Don't do anything when the selection point is on the last line
-            if (character < m_Text.getSize())
-            {
-                // Try to find the closest character
-                for ( ; character < m_Text.getSize() + 1; ++character)
-                {
-                    // Get the position of the character after it
-                    newPosition = sf::Vector2u(tempText.findCharacterPos(character + newlinesAdded - newlineAdded + 1));
-
-                    // The character must remain on the same line
-                    if (newPosition.y > newTopPosition)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character - newlineAdded);
-                        return;
-                    }
-
-                    // Calculate the distance to the original position
-                    distanceX = newPosition.x - originalPosition.x;
-
-                    // Check if the distance is going away again
-                    if (abs(distanceX) > previousdistanceX)
-                    {
-                        // We have found the character that we were looking for
-                        setSelectionPointPosition(character - newlineAdded);
-                        return;
-                    }
-
-                    // Remember the previous distance
-                    previousdistanceX = abs(distanceX);
-                }
-
-                // If you pass here then the selection point should be at the end of the text
-                setSelectionPointPosition(m_Text.getSize());
-            }
+            if (line + 1 < m_LineStarts.size())
+                setSelectionPointPosition(findCharacterOnLine(line + 1, findCharacterPosition(m_SelEnd).x));
         }
         else if (event.code == sf::Keyboard::Home)
         {
@@ -1344,7 +1248,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::End)
         {
@@ -1353,7 +1257,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
         }
         else if (event.code == sf::Keyboard::Return)
         {
@@ -1373,7 +1277,7 @@ namespace tgui
                     return;
 
                 // Erase the character
-                m_Text.erase(m_SelEnd-1, 1);
+                eraseText(m_SelEnd-1, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd - 1);
@@ -1397,13 +1301,13 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                m_Callback.text    = m_Text.getString();
                 addCallback();
             }
         }
@@ -1420,7 +1324,7 @@ namespace tgui
                     return;
 
                 // Erase the character
-                m_Text.erase(m_SelEnd, 1);
+                eraseText(m_SelEnd, 1);
 
                 // Set the selection point back on the correct position
                 setSelectionPointPosition(m_SelEnd);
@@ -1444,13 +1348,13 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(500));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                m_Callback.text    = m_Text.getString();
                 addCallback();
             }
         }
@@ -1461,10 +1365,7 @@ namespace tgui
             {
                 if (event.code == sf::Keyboard::C)
                 {
-                    if ((m_TextSelection1.getString() != "") && (m_TextSelection2.getString() != ""))
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + "\n" + m_TextSelection2.getString());
-                    else
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.getString(TGUI_MINIMUM(m_SelStart, m_SelEnd), TGUI_MAXIMUM(m_SelStart, m_SelEnd)));
                 }
                 else if (event.code == sf::Keyboard::V)
                 {
@@ -1480,28 +1381,22 @@ namespace tgui
 
                         unsigned int oldCaretPos = m_SelEnd;
 
-                        if (m_Text.getSize() > m_SelEnd)
-                            setText(m_Text.toWideString().substr(0, m_SelEnd) + TGUI_Clipboard.get() + m_Text.toWideString().substr(m_SelEnd, m_Text.getSize() - m_SelEnd));
-                        else
-                            setText(m_Text + clipboardContents);
+                        insertText(m_SelEnd, clipboardContents);
 
                         setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
 
                         // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        if (isCallbackBound(TextChanged))
                         {
                             m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
+                            m_Callback.text    = m_Text.getString();
                             addCallback();
                         }
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
                 {
-                    if ((m_TextSelection1.getString() != "") && (m_TextSelection2.getString() != ""))
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + "\n" + m_TextSelection2.getString());
-                    else
-                        TGUI_Clipboard.set(m_TextSelection1.getString() + m_TextSelection2.getString());
+                    TGUI_Clipboard.set(m_Text.getString(TGUI_MINIMUM(m_SelStart, m_SelEnd), TGUI_MAXIMUM(m_SelStart, m_SelEnd)));
 
                     if (m_readOnly)
                         return;
@@ -1514,12 +1409,7 @@ namespace tgui
                     m_SelEnd = m_Text.getSize();
                     m_SelChars = m_Text.getSize();
 
-                    m_TextBeforeSelection.setString("");
-                    m_TextSelection1.setString(m_DisplayedText);
-                    m_TextSelection2.setString("");
-                    m_TextAfterSelection1.setString("");
-                    m_TextAfterSelection2.setString("");
-
+                    m_SelectionTextsNeedUpdate = true;
                     updateDisplayedText();
                 }
             }
@@ -1530,6 +1420,8 @@ namespace tgui
 
     void TextBox::textEntered(sf::Uint32 key)
     {
+        invalidate();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -1544,77 +1436,32 @@ namespace tgui
         if ((m_MaxChars > 0) && (m_Text.getSize() + 1 > m_MaxChars))
                 return;
 
-        // If there is a limit in the amount of lines then make a simulation
-        if (m_Scroll == nullptr)
-        {
-            // Don't continue when line height is 0
-            if (m_LineHeight == 0)
-                return;
-
-            float maxLineWidth = TGUI_MAXIMUM(m_Size.x - 4.0f, 0);
-
-            // Make some preparations
-            sf::Text tempText(m_TextBeforeSelection);
-            unsigned int beginChar = 0;
-            unsigned int newlinesAdded = 0;
-
-            sf::String text = m_Text;
-            text.insert(m_SelEnd, key);
-
-            sf::String displayedText = text;
-            unsigned int lines = 1;
-
-            // Loop through every character
-            for (unsigned i=1; i < text.getSize() + 1; ++i)
-            {
-                // Make sure the character is not a newline
-                if (text[i-1] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(text.toWideString().substr(beginChar, i - beginChar));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i).x > maxLineWidth)
-                    {
-                        // Insert the newline character
-                        displayedText.insert(i + newlinesAdded - 1, '\n');
+        // Don't continue when line height is 0
+        if ((m_Scroll == nullptr) && (m_LineHeight == 0))
+            return;
 
-                        // Prepare to find the next line end
-                        beginChar = i - 1;
-                        ++newlinesAdded;
-                        ++lines;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i;
-                    ++lines;
-                }
+        // Insert our character
+        insertText(m_SelEnd, key);
 
-                // Check if you passed this limit
-                if (lines > m_Size.y / m_LineHeight)
-                {
-                    // The character can't be added
-                    return;
-                }
-            }
+        // If there is a limit in the amount of lines then the character can't be added when the text no longer fits
+        if ((m_Scroll == nullptr) && (m_LineStarts.size() > m_Size.y / m_LineHeight))
+        {
+            eraseText(m_SelEnd, 1);
+            return;
         }
 
-        // Insert our character
-        m_Text.insert(m_SelEnd, key);
-
         // Move our selection point forward
         setSelectionPointPosition(m_SelEnd + 1);
 
         // The selection point should be visible again
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(500));
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[TextChanged].empty() == false)
+        if (isCallbackBound(TextChanged))
         {
             m_Callback.trigger = TextChanged;
-            m_Callback.text    = m_Text;
+            m_Callback.text    = m_Text.getString();
             addCallback();
         }
     }
@@ -1623,6 +1470,8 @@ namespace tgui
 
     void TextBox::mouseWheelMoved(int delta, int, int)
     {
+        invalidate();
+
         // Only do something when there is a scrollbar
         if (m_Scroll != nullptr)
         {
@@ -1644,19 +1493,34 @@ namespace tgui
                     else
                         m_Scroll->setValue(0);
                 }
+
+                // Only the lines that became visible have to be created
+                m_SelectionTextsNeedUpdate = true;
+                updateDisplayedText();
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::widgetUnfocused()
+    void TextBox::widgetFocused()
     {
-        // If there is a selection then undo it now
-        if (m_SelChars)
-            setSelectionPointPosition(m_SelEnd);
+        // Start blinking the selection point
+        m_SelectionPointVisible = true;
+        scheduleUpdate(sf::milliseconds(500));
 
-        Widget::widgetUnfocused();
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::widgetUnfocused()
+    {
+        // If there is a selection then undo it now
+        if (m_SelChars)
+            setSelectionPointPosition(m_SelEnd);
+
+        Widget::widgetUnfocused();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1778,7 +1642,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+            if (isCallbackBoundToParentOnly(TextChanged))
                 callbacks.push_back("TextChanged");
 
             encodeList(callbacks, value);
@@ -1848,144 +1712,22 @@ namespace tgui
                 line = static_cast<unsigned int>((posY + m_Scroll->getValue()) / m_LineHeight + 1);
         }
 
-        // Create a temporary text widget that contains the full text
-        sf::Text fullText(m_TextBeforeSelection);
-        fullText.setString(m_DisplayedText);
-
-        // Check if you clicked behind all characters
-        if ((line > m_Lines) || ((line == m_Lines) && (posX > fullText.findCharacterPos(m_DisplayedText.getSize()).x)))
+        // Check if you clicked below all lines
+        if (line > m_Lines)
         {
             // The selection point should be behind the last character
             return m_Text.getSize();
         }
-        else // You clicked inside the text
-        {
-            // Prepare to skip part of the text
-            sf::String tempString = m_DisplayedText;
-            std::size_t newlinePos = 0;
-
-            // Only remove lines when there are lines to remove
-            if (line > 1)
-            {
-                unsigned int i=1;
-
-                // If the first character is a newline then remove it if needed
-                if (m_Text[0] == '\n')
-                    ++i;
-
-                // Skip the lines above the line where you clicked
-                for ( ; i<line; ++i)
-                    newlinePos = tempString.find('\n', newlinePos + 1);
-
-                // Remove the first lines
-                tempString.erase(0, newlinePos + 1);
-            }
-
-            // Only keep one line
-            std::size_t newlinePos2 = tempString.find('\n');
-            if (newlinePos2 != sf::String::InvalidPos)
-                tempString.erase(newlinePos2, sf::String::InvalidPos);
-
-            // Create a temporary text widget
-            sf::Text tempText(m_TextBeforeSelection);
-
-            // We are going to calculate the number of newlines we have added
-            unsigned int newlinesAdded = 0;
-            unsigned int totalNewlinesAdded = 0;
-            unsigned int beginChar = 0;
-            sf::String   tempString2 = m_Text;
-
-            // Calculate the maximum line width
-            float maxLineWidth = m_Size.x - 4.0f;
-            if (m_Scroll != nullptr)
-                maxLineWidth -= m_Scroll->getSize().x;
-
-            // If the width is negative then the text box is too small to be displayed
-            if (maxLineWidth < 0)
-                maxLineWidth = 0;
-
-            // Loop through every character
-            for (unsigned i = 1; (i < m_Text.getSize() + 1) && (totalNewlinesAdded != line - 1); ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i-1] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar));
-
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i).x > maxLineWidth)
-                    {
-                        // Insert the newline character
-                        tempString2.insert(i + newlinesAdded - 1, '\n');
 
-                        // Prepare to find the next line end
-                        beginChar = i - 1;
-                        ++newlinesAdded;
-                        ++totalNewlinesAdded;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i;
-                    ++totalNewlinesAdded;
-                }
-            }
-
-            // Store the single line that we found a while ago in the temporary text widget
-            tempText.setString(tempString);
-
-            // If the line contains nothing but a newline character then put the selction point on that line
-            if (tempString.getSize() == 0)
-            {
-                if (line > 1)
-                    return newlinePos - newlinesAdded + 1;
-                else
-                    return newlinePos;
-            }
-
-            // Check if the click occured before the first character
-            if ((tempString.getSize() == 1) && (posX < (tempText.findCharacterPos(1).x / 2.f)))
-            {
-                if (line > 1)
-                    return newlinePos - newlinesAdded;
-                else
-                {
-                    if (newlinePos > 0)
-                        return newlinePos - 1;
-                    else
-                        return 0;
-                }
-            }
-
-            // Try to find between which characters the mouse is standing
-            for (unsigned int i = 1; i <= tempString.getSize(); ++i)
-            {
-                if (posX < (tempText.findCharacterPos(i-1).x + tempText.findCharacterPos(i).x) / 2.f)
-                {
-                    if (line > 1)
-                        return newlinePos + i - newlinesAdded;
-                    else
-                        return newlinePos + i - 1;
-                }
-
-            }
-
-            // The mouse is on the second half of the last character on the line
-            if (line > 1)
-                return newlinePos + tempString.getSize() + 1 - newlinesAdded;
-            else
-                return newlinePos + tempString.getSize();
-        }
-
-        // Something went wrong, don't move the selection point position
-        return m_SelEnd;
+        return findCharacterOnLine(line - 1, posX);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::selectText(float posX, float posY)
     {
+        invalidate();
+
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return;
@@ -2003,57 +1745,41 @@ namespace tgui
         m_SelectionTextsNeedUpdate = true;
         updateDisplayedText();
 
-        // Check if there is a scrollbar
-        if (m_Scroll != nullptr)
-        {
-            unsigned int newlines = 0;
-            unsigned int newlinesAdded = 0;
-            unsigned int totalLines = 0;
+        // Make sure that the selection point is visible
+        scrollToSelectionPoint();
+    }
 
-            // Loop through all characters
-            for (unsigned int i=0; i<m_SelEnd; ++i)
-            {
-                // Make sure there is no newline in the text
-                if (m_Text[i] != '\n')
-                {
-                    // Check if there is a newline in the displayed text
-                    if (m_DisplayedText[i + newlinesAdded] == '\n')
-                    {
-                        // A newline was added here
-                        ++newlinesAdded;
-                        ++totalLines;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                        if (i < m_SelEnd)
-                            ++newlines;
-                    }
-                }
-                else // The text already contains a newline
-                {
-                    ++totalLines;
+    void TextBox::scrollToSelectionPoint()
+    {
+        // Nothing has to be scrolled when there is no scrollbar
+        if (m_Scroll == nullptr)
+            return;
 
-                    if (i < m_SelEnd)
-                        ++newlines;
-                }
-            }
+        // Find the line on which the selection point is located
+        unsigned int newlines = findLineOfCharacter(m_SelEnd);
 
-            // Check if the selection point is located above the view
-            if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
-            {
-                m_Scroll->setValue(newlines * m_LineHeight);
-                updateDisplayedText();
-            }
+        // Check if the selection point is located above the view
+        if ((newlines < m_TopLine - 1) || ((newlines < m_TopLine) && (m_Scroll->getValue() % m_LineHeight > 0)))
+        {
+            m_Scroll->setValue(newlines * m_LineHeight);
+            m_SelectionTextsNeedUpdate = true;
+            updateDisplayedText();
+        }
 
-            // Check if the selection point is below the view
-            else if (newlines > m_TopLine + m_VisibleLines - 2)
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
-                updateDisplayedText();
-            }
-            else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
-            {
-                m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
-                updateDisplayedText();
-            }
+        // Check if the selection point is below the view
+        else if (newlines > m_TopLine + m_VisibleLines - 2)
+        {
+            m_Scroll->setValue((newlines - m_VisibleLines + 1) * m_LineHeight);
+            m_SelectionTextsNeedUpdate = true;
+            updateDisplayedText();
+        }
+        else if ((newlines > m_TopLine + m_VisibleLines - 3) && (m_Scroll->getValue() % m_LineHeight > 0))
+        {
+            m_Scroll->setValue((newlines - m_VisibleLines + 2) * m_LineHeight);
+            m_SelectionTextsNeedUpdate = true;
+            updateDisplayedText();
         }
     }
 
@@ -2066,7 +1792,7 @@ namespace tgui
             return;
 
         // Erase the characters
-        m_Text.erase(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars);
+        eraseText(TGUI_MINIMUM(m_SelStart, m_SelEnd), m_SelChars);
 
         // Set the selection point back on the correct position
         setSelectionPointPosition(TGUI_MINIMUM(m_SelStart, m_SelEnd));
@@ -2074,16 +1800,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateDisplayedText()
+    float TextBox::getCharacterWidth(sf::Uint32 prevChar, sf::Uint32 curChar) const
     {
-        // Don't continue when the text box wasn't loaded correctly
-        if (m_Loaded == false)
-            return;
+        if (m_TextFont == nullptr)
+            return 0;
 
-        // Don't continue when line height is 0
-        if (m_LineHeight == 0)
-            return;
+        float width = TGUI_TextMetrics.getAdvance(*m_TextFont, m_TextSize, curChar);
+        if (prevChar != 0)
+            width += TGUI_TextMetrics.getKerning(*m_TextFont, m_TextSize, prevChar, curChar);
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextBox::getTextWidth(std::size_t start, std::size_t end) const
+    {
+        float width = 0;
+        for (std::size_t i = start; i < end; ++i)
+            width += getCharacterWidth((i > start) ? m_Text[i-1] : 0, m_Text[i]);
 
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextBox::getMaximumLineWidth() const
+    {
         float maxLineWidth = m_Size.x - 4.0f;
         if (m_Scroll != nullptr)
             maxLineWidth -= m_Scroll->getSize().x;
@@ -2092,67 +1835,348 @@ namespace tgui
         if (maxLineWidth < 0)
             maxLineWidth = 0;
 
-        // Make some preparations
-        sf::Text tempText(m_TextBeforeSelection);
-        unsigned int beginChar = 0;
-        unsigned int newlinesAdded = 0;
-        unsigned int newlinesAddedBeforeSelection = 0;
+        return maxLineWidth;
+    }
 
-        m_DisplayedText = m_Text;
-        m_Lines = 1;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextBox::findLineOfCharacter(std::size_t index) const
+    {
+        unsigned int line = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), index) - m_LineStarts.begin() - 1;
 
-        // Loop through every character
-        for (unsigned i=1; i < m_Text.getSize() + 1; ++i)
+        // If the line was wrapped in front of the character then the selection point is shown behind the previous line
+        if ((line > 0) && (m_LineStarts[line] == index) && (m_Text[index-1] != '\n'))
+            --line;
+
+        return line;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f TextBox::findCharacterPosition(std::size_t index) const
+    {
+        if (index > m_Text.getSize())
+            index = m_Text.getSize();
+
+        unsigned int line = findLineOfCharacter(index);
+        return sf::Vector2f(getTextWidth(m_LineStarts[line], index), static_cast<float>(line * m_LineHeight));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getLineEnd(unsigned int line) const
+    {
+        if (line + 1 >= m_LineStarts.size())
+            return m_Text.getSize();
+
+        // Don't include the newline character
+        std::size_t lineEnd = m_LineStarts[line + 1];
+        if (m_Text[lineEnd - 1] == '\n')
+            --lineEnd;
+
+        return lineEnd;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::findCharacterOnLine(unsigned int line, float posX) const
+    {
+        const std::size_t lineStart = m_LineStarts[line];
+        const std::size_t lineEnd = getLineEnd(line);
+
+        // Try to find between which characters the position is located
+        float characterLeft = 0;
+        for (std::size_t i = lineStart; i < lineEnd; ++i)
         {
-            // Make sure the character is not a newline
-            if (m_Text[i-1] != '\n')
-            {
-                // Add the next character to the text widget
-                tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar));
+            const float characterWidth = getCharacterWidth((i > lineStart) ? m_Text[i-1] : 0, m_Text[i]);
+            if (posX < characterLeft + (characterWidth / 2.f))
+                return i;
 
-                // Check if the string still fits on the line
-                if (tempText.findCharacterPos(i).x > maxLineWidth)
-                {
-                    // Insert the newline character
-                    m_DisplayedText.insert(i + newlinesAdded - 1, '\n');
+            characterLeft += characterWidth;
+        }
 
-                    // Prepare to find the next line end
-                    beginChar = i - 1;
-                    ++newlinesAdded;
-                    ++m_Lines;
-                }
-            }
-            else // The character was a newline
+        // The position is on the second half of the last character on the line
+        return lineEnd;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::insertText(std::size_t position, const sf::String& text)
+    {
+        m_Text.insert(position, text);
+        updateLineStarts(position, 0, text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::eraseText(std::size_t position, std::size_t count)
+    {
+        if (position >= m_Text.getSize())
+            return;
+
+        if (count > m_Text.getSize() - position)
+            count = m_Text.getSize() - position;
+
+        m_Text.erase(position, count);
+        updateLineStarts(position, count, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::appendUtf8Text(const char* begin, const char* end)
+    {
+        // The characters are decoded into a small buffer first, so that they can be added to the text in large groups
+        sf::Uint32 characters[1024];
+        std::size_t count = 0;
+        while (begin < end)
+        {
+            begin = sf::Utf8::decode(begin, end, characters[count], 0xFFFD);
+            if (++count == 1024)
             {
-                beginChar = i;
-                ++m_Lines;
+                m_Text.insert(m_Text.getSize(), characters, count);
+                count = 0;
             }
+        }
+
+        m_Text.insert(m_Text.getSize(), characters, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::finishLoadingText()
+    {
+        // The view starts at the top of the new text
+        m_SelChars = 0;
+        m_SelStart = 0;
+        m_SelEnd = 0;
+
+        if (m_Scroll != nullptr)
+            m_Scroll->setValue(0);
+
+        // Only the lines that can be seen are wrapped now
+        m_LineStartsComplete = false;
+        updateLineStarts();
+
+        setSelectionPointPosition(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::findNextLineStart(std::size_t lineStart, float maxLineWidth) const
+    {
+        float lineWidth = 0;
+        for (std::size_t i = lineStart; i < m_Text.getSize(); ++i)
+        {
+            // The next line starts behind a newline character
+            if (m_Text[i] == '\n')
+                return i + 1;
+
+            // Check if the character still fits on the line (there is always at least one character on a line)
+            lineWidth += getCharacterWidth((i > lineStart) ? m_Text[i-1] : 0, m_Text[i]);
+            if ((lineWidth > maxLineWidth) && (i > lineStart))
+                return i;
+        }
+
+        return m_Text.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateLineStarts()
+    {
+        m_SelectionTextsNeedUpdate = true;
+
+        m_LineStartsWidth = getMaximumLineWidth();
+        m_LineStarts.assign(1, 0);
+
+        // When the text was loaded and is still being wrapped then the update function will wrap the rest of the lines again
+        if (m_LineStartsComplete == false)
+        {
+            wrapNeededLines();
+
+            if (m_LineStartsComplete == false)
+                scheduleUpdate(sf::Time::Zero);
+        }
+        else
+            wrapLines(sf::String::InvalidPos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateLineStarts(std::size_t position, std::size_t removedChars, std::size_t insertedChars)
+    {
+        m_SelectionTextsNeedUpdate = true;
+
+        // When the lines were calculated for another width then the whole text has to be wrapped again
+        if (getMaximumLineWidth() != m_LineStartsWidth)
+        {
+            updateLineStarts();
+            return;
+        }
+
+        // Nothing has to be done when the change lies behind the lines that are known, that part is still going to be wrapped
+        if ((m_LineStartsComplete == false) && (position > m_LineStarts.back()))
+            return;
+
+        // A change at the start of a line can make the previous line longer, so start wrapping from the line in front of it
+        std::size_t firstLine = std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), position) - m_LineStarts.begin() - 1;
+        if (firstLine > 0)
+            --firstLine;
+
+        std::vector<unsigned int> newLineStarts;
+        std::size_t oldLine = firstLine + 1;
+        bool linesReused = false;
+
+        std::size_t lineStart = m_LineStarts[firstLine];
+        while (true)
+        {
+            std::size_t nextLineStart = findNextLineStart(lineStart, m_LineStartsWidth);
 
-            // Find the position of the selection point
-            if (m_SelEnd == i - 1)
-                newlinesAddedBeforeSelection = newlinesAdded;
+            // Stop when the last line has been found
+            if ((nextLineStart == m_Text.getSize()) && ((nextLineStart == lineStart) || (m_Text[nextLineStart - 1] != '\n')))
+            {
+                m_LineStartsComplete = true;
+                break;
+            }
 
-            // Check if there is a limit in the amount of lines
-            if (m_Scroll == nullptr)
+            // Behind the changed characters, the lines are the same as before once a line starts at the same character again
+            if (nextLineStart >= position + insertedChars)
             {
-                // Check if you passed this limit
-                if (m_Lines > m_Size.y / m_LineHeight)
-                {
-                    // Remove all exceeding lines
-                    m_DisplayedText.erase(i + newlinesAdded - 1, sf::String::InvalidPos);
-                    m_Text.erase(i-1, sf::String::InvalidPos);
+                const std::size_t oldLineStart = nextLineStart - insertedChars + removedChars;
+                while ((oldLine < m_LineStarts.size()) && (m_LineStarts[oldLine] < oldLineStart))
+                    ++oldLine;
 
-                    // We counted one line too much
-                    --m_Lines;
+                if ((oldLine < m_LineStarts.size()) && (m_LineStarts[oldLine] == oldLineStart))
+                {
+                    linesReused = true;
+                    break;
+                }
 
+                // The lines behind the last known line start of a loaded text will still be wrapped later
+                if ((m_LineStartsComplete == false) && (oldLineStart > m_LineStarts.back()))
+                {
+                    newLineStarts.push_back(nextLineStart);
                     break;
                 }
             }
+
+            newLineStarts.push_back(nextLineStart);
+            lineStart = nextLineStart;
         }
 
-        // Find the position of the selection point
-        if (m_SelEnd == m_Text.getSize())
-            newlinesAddedBeforeSelection = newlinesAdded;
+        // The lines that are kept still have to be moved to their new position in the text
+        if (linesReused)
+        {
+            for (std::size_t i = oldLine; i < m_LineStarts.size(); ++i)
+                m_LineStarts[i] = m_LineStarts[i] + insertedChars - removedChars;
+        }
+        else
+            oldLine = m_LineStarts.size();
+
+        m_LineStarts.erase(m_LineStarts.begin() + firstLine + 1, m_LineStarts.begin() + oldLine);
+        m_LineStarts.insert(m_LineStarts.begin() + firstLine + 1, newLineStarts.begin(), newLineStarts.end());
+
+        m_Lines = m_LineStarts.size();
+
+        // The inserted characters may have moved the lines that are needed behind the lines that are known
+        wrapNeededLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::wrapLines(std::size_t maxCharacters)
+    {
+        std::size_t lineStart = m_LineStarts.back();
+
+        std::size_t stopPosition = m_Text.getSize();
+        if (maxCharacters < m_Text.getSize() - lineStart)
+            stopPosition = lineStart + maxCharacters;
+
+        while (true)
+        {
+            std::size_t nextLineStart = findNextLineStart(lineStart, m_LineStartsWidth);
+
+            // Stop when the last line has been found
+            if ((nextLineStart == m_Text.getSize()) && ((nextLineStart == lineStart) || (m_Text[nextLineStart - 1] != '\n')))
+            {
+                m_LineStartsComplete = true;
+                break;
+            }
+
+            m_LineStarts.push_back(nextLineStart);
+            lineStart = nextLineStart;
+
+            if (lineStart > stopPosition)
+                break;
+        }
+
+        m_Lines = m_LineStarts.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::wrapNeededLines()
+    {
+        if (m_LineStartsComplete)
+            return;
+
+        unsigned int scrollValue = 0;
+        if (m_Scroll != nullptr)
+            scrollValue = m_Scroll->getValue();
+
+        // The last known line is never used, because it is not yet known where it ends
+        std::size_t linesNeeded = 1;
+        if (m_LineHeight > 0)
+            linesNeeded = (scrollValue + m_Size.y + m_LineHeight - 1) / m_LineHeight + 1;
+
+        const std::size_t selectionEnd = TGUI_MAXIMUM(m_SelStart, m_SelEnd);
+        while ((m_LineStartsComplete == false)
+            && ((m_LineStarts.size() <= linesNeeded) || (m_LineStarts[m_LineStarts.size() - 2] <= selectionEnd)))
+        {
+            wrapLines(0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDisplayedText()
+    {
+        // Don't continue when the text box wasn't loaded correctly
+        if (m_Loaded == false)
+            return;
+
+        // Don't continue when line height is 0
+        if (m_LineHeight == 0)
+            return;
+
+        // When the width of the text box has changed then the whole text has to be wrapped again
+        if (getMaximumLineWidth() != m_LineStartsWidth)
+            updateLineStarts();
+
+        // Make sure that the lines that will be shown have been wrapped
+        wrapNeededLines();
+
+        // Check if there is a limit in the amount of lines
+        const unsigned int maxLines = TGUI_MAXIMUM(m_Size.y / m_LineHeight, 1u);
+        if ((m_Scroll == nullptr) && (m_LineStarts.size() > maxLines))
+        {
+            // Remove all exceeding lines, including the newline character in front of them
+            std::size_t removeFrom = m_LineStarts[maxLines];
+            if (m_Text[removeFrom - 1] == '\n')
+                --removeFrom;
+
+            m_Text.erase(removeFrom, sf::String::InvalidPos);
+            m_LineStarts.resize(maxLines);
+            m_LineStartsComplete = true;
+
+            // The selection can't lie behind the text
+            m_SelectionTextsNeedUpdate = true;
+            m_SelStart = TGUI_MINIMUM(m_SelStart, m_Text.getSize());
+            m_SelEnd = TGUI_MINIMUM(m_SelEnd, m_Text.getSize());
+            m_SelChars = TGUI_MAXIMUM(m_SelStart, m_SelEnd) - TGUI_MINIMUM(m_SelStart, m_SelEnd);
+        }
+
+        m_Lines = m_LineStarts.size();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -2178,178 +2202,83 @@ namespace tgui
             m_VisibleLines = TGUI_MINIMUM(m_Size.y / m_LineHeight, m_Lines);
         }
 
-        // Fill the temporary text widget with the whole text
-        tempText.setString(m_DisplayedText);
-
         // Set the position of the selection point
-        m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection));
+        m_SelectionPointPosition = sf::Vector2u(findCharacterPosition(m_SelEnd));
 
-        // Only do the check when the selection point is not standing at the first character
-        if ((m_SelEnd > 0) && (m_SelEnd + newlinesAddedBeforeSelection > 0))
-        {
-            // If you are at the end of the line then also set the selection point there, instead of at the beginning of the next line
-            if ((m_Text[m_SelEnd - 1] != '\n') && (m_DisplayedText[m_SelEnd + newlinesAddedBeforeSelection - 1] == '\n'))
-                m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection - 1));
-        }
-
-        // Check if the text has to be redivided in five pieces
+        // Check if the texts of the visible lines have to be recreated
         if (m_SelectionTextsNeedUpdate)
-            updateSelectionTexts(maxLineWidth);
+            updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts(float maxLineWidth)
+    void TextBox::updateVisibleLines()
     {
-        // If there is no selection then just put the whole text in m_TextBeforeSelection
-        if (m_SelChars == 0)
-        {
-            m_TextBeforeSelection.setString(m_DisplayedText);
-            m_TextSelection1.setString("");
-            m_TextSelection2.setString("");
-            m_TextAfterSelection1.setString("");
-            m_TextAfterSelection2.setString("");
+        m_SelectionTextsNeedUpdate = false;
 
-            // Clear the list of selection rectangle sizes
-            m_MultilineSelectionRectWidth.clear();
-        }
-        else // Some text is selected
-        {
-            // Make some preparations
-            unsigned i;
-            unsigned int selectionStart = TGUI_MINIMUM(m_SelEnd, m_SelStart);
-            unsigned int selectionEnd = TGUI_MAXIMUM(m_SelEnd, m_SelStart);
-
-            sf::Text tempText(m_TextBeforeSelection);
-            unsigned int beginChar = 0;
-            unsigned int newlinesAddedBeforeSelection = 0;
-            unsigned int newlinesAddedInsideSelection = 0;
-            unsigned int lastNewlineBeforeSelection = 0;
-            bool newlineFoundInsideSelection = false;
-
-            // Clear the list of selection rectangle sizes
-            m_MultilineSelectionRectWidth.clear();
+        m_LineTexts.clear();
+        m_SelectionRects.clear();
+        m_TextShift = sf::Vector2f(0, 0);
 
-            // Loop through every character before the selection
-            for (i=0; i < selectionStart; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar + 1));
+        // Nothing can be shown without a font
+        if ((m_TextFont == nullptr) || (m_LineHeight == 0))
+            return;
 
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        lastNewlineBeforeSelection = i;
-                        ++newlinesAddedBeforeSelection;
-                    }
-                }
-                else // The character was a newline
-                {
-                    beginChar = i+1;
-                    lastNewlineBeforeSelection = i;
-                }
-            }
+        // The texts are shifted so that the highest and most left character touches the top left of the line
+        sf::Text tempText("kg", *m_TextFont, m_TextSize);
+        m_TextShift = sf::Vector2f(tempText.getLocalBounds().left, tempText.getLocalBounds().top);
 
-            // Reset the position from where we should start looking for newlines
-            beginChar = lastNewlineBeforeSelection;
+        // Find the lines that are (partially) inside the text box
+        unsigned int scrollValue = 0;
+        if (m_Scroll != nullptr)
+            scrollValue = m_Scroll->getValue();
 
-            // Loop through every selected character
-            for (i=selectionStart; i < selectionEnd; ++i)
-            {
-                // Make sure the character is not a newline
-                if (m_Text[i] != '\n')
-                {
-                    // Add the next character to the text widget
-                    tempText.setString(m_Text.toWideString().substr(beginChar, i - beginChar + 1));
+        const unsigned int firstLine = TGUI_MINIMUM(scrollValue / m_LineHeight, m_Lines);
+        const unsigned int lastLine = TGUI_MINIMUM((scrollValue + m_Size.y + m_LineHeight - 1) / m_LineHeight, m_Lines);
 
-                    // Check if the string still fits on the line
-                    if (tempText.findCharacterPos(i+1).x > maxLineWidth)
-                    {
-                        beginChar = i;
-                        ++newlinesAddedInsideSelection;
-                    }
-                }
-                else // The character was a newline
-                    beginChar = i+1;
-            }
+        const std::size_t selectionStart = TGUI_MINIMUM(m_SelStart, m_SelEnd);
+        const std::size_t selectionEnd = TGUI_MAXIMUM(m_SelStart, m_SelEnd);
 
-            // Find out where the selection starts and where it ends
-            if (m_SelEnd < m_SelStart)
+        for (unsigned int line = firstLine; line < lastLine; ++line)
+        {
+            const std::size_t lineStart = m_LineStarts[line];
+            const std::size_t lineEnd = getLineEnd(line);
+            const float top = static_cast<float>(line * m_LineHeight);
+
+            // Find out which part of the line is selected
+            std::size_t selectedStart = TGUI_MAXIMUM(selectionStart, lineStart);
+            std::size_t selectedEnd = TGUI_MINIMUM(selectionEnd, lineEnd);
+            if (selectedStart < selectedEnd)
             {
-                selectionStart = m_SelEnd + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelStart + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
+                const float left = getTextWidth(lineStart, selectedStart);
+                m_SelectionRects.push_back(sf::FloatRect(left, top, getTextWidth(lineStart, selectedEnd) - left, static_cast<float>(m_LineHeight)));
             }
-            else
+            else // Nothing is selected on this line
             {
-                selectionStart = m_SelStart + newlinesAddedBeforeSelection;
-                selectionEnd = m_SelEnd + newlinesAddedBeforeSelection + newlinesAddedInsideSelection;
-            }
-
-            // Create another temprary text widget
-            sf::Text tempText2(m_TextBeforeSelection);
-            tempText2.setString(m_DisplayedText);
+                // An empty line in the middle of the selection still gets a small background
+                if ((lineStart == lineEnd) && (selectionStart <= lineStart) && (selectionEnd > lineEnd))
+                    m_SelectionRects.push_back(sf::FloatRect(0, top, 2, static_cast<float>(m_LineHeight)));
 
-            // Loop through the selected characters again
-            for (i=selectionStart; i<selectionEnd; ++i)
-            {
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Check if this is not the first newline
-                    if (newlineFoundInsideSelection == true)
-                    {
-                        // Add a new rectangle to the selection
-                        if (tempText2.findCharacterPos(i).x > 0)
-                            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
-                        else
-                            m_MultilineSelectionRectWidth.push_back(2);
-                    }
-                    else // This is the first newline, skip it
-                        newlineFoundInsideSelection = true;
-                }
-            }
-
-            // Add the last selection rectangle
-            m_MultilineSelectionRectWidth.push_back(tempText2.findCharacterPos(i).x);
-
-            // Set the text before selection
-            m_TextBeforeSelection.setString(m_DisplayedText.toWideString().substr(0, selectionStart));
-
-            // Set the text that is selected. If it consists of multiple lines then it will be changed below.
-            m_TextSelection1.setString(m_DisplayedText.toWideString().substr(selectionStart, m_SelChars));
-            m_TextSelection2.setString("");
-
-            // Loop through every character inside the selection
-            for (i=selectionStart; i < selectionEnd; ++i)
-            {
-                // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Set the text that is selected
-                    m_TextSelection1.setString(m_DisplayedText.toWideString().substr(selectionStart, i - selectionStart));
-                    m_TextSelection2.setString(m_DisplayedText.toWideString().substr(i + 1, m_SelChars + newlinesAddedInsideSelection + selectionStart - i - 1));
-                    break;
-                }
+                selectedStart = lineEnd;
+                selectedEnd = lineEnd;
             }
 
-            // Set the text after the selection. If it consists of multiple lines then it will be changed below.
-            m_TextAfterSelection1.setString(m_DisplayedText.toWideString().substr(selectionEnd, m_DisplayedText.getSize() - selectionEnd));
-            m_TextAfterSelection2.setString("");
-
-            // Loop through every character after the selection
-            for (i=selectionEnd; i < m_DisplayedText.getSize(); ++i)
+            // The line is split in the part in front of the selection, the selected part and the part behind the selection
+            const std::size_t parts[4] = {lineStart, selectedStart, selectedEnd, lineEnd};
+            for (unsigned int i = 0; i < 3; ++i)
             {
-                // Check if the character is a newline
-                if (m_DisplayedText[i] == '\n')
-                {
-                    // Set the text that is selected
-                    m_TextAfterSelection1.setString(m_DisplayedText.toWideString().substr(selectionEnd, i - selectionEnd));
-                    m_TextAfterSelection2.setString(m_DisplayedText.toWideString().substr(i + 1, m_DisplayedText.getSize() - i - 1));
-                    break;
-                }
+                if (parts[i] == parts[i+1])
+                    continue;
+
+                // The part starts where its first character is drawn on the line, which includes the kerning
+                float left = getTextWidth(lineStart, parts[i]);
+                if (parts[i] > lineStart)
+                    left += TGUI_TextMetrics.getKerning(*m_TextFont, m_TextSize, m_Text[parts[i] - 1], m_Text[parts[i]]);
+
+                sf::Text text(m_Text.getString(parts[i], parts[i+1]), *m_TextFont, m_TextSize);
+                text.setColor((i == 1) ? m_SelectedTextColor : m_TextColor);
+                text.setPosition(left, top);
+                m_LineTexts.push_back(text);
             }
         }
     }
@@ -2366,22 +2295,48 @@ namespace tgui
 
     void TextBox::update()
     {
-        // Only show/hide the selection point every half second
-        if (m_AnimationTimeElapsed < sf::milliseconds(500))
-            return;
+        // Wrap the next part of a loaded text, the scrollbar grows while this happens
+        if (m_LineStartsComplete == false)
+        {
+            wrapLines(charactersWrappedPerUpdate);
+            updateDisplayedText();
+            invalidate();
+
+            // The selection point still blinks every half second in between
+            if (m_AnimationTimeElapsed < sf::milliseconds(500))
+            {
+                if (m_LineStartsComplete == false)
+                    scheduleUpdate(sf::Time::Zero);
+                else if (m_Focused)
+                    scheduleUpdate(sf::milliseconds(500) - m_AnimationTimeElapsed);
+
+                return;
+            }
+        }
 
-        // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
 
-        // Only update when the editbox is visible
+        // Keep blinking as long as the text box is focused
+        if (m_Focused)
+            scheduleUpdate(sf::milliseconds(500));
+
+        // Only update when the textbox is visible
         if (m_Visible == false)
             return;
 
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn when focused
+        if (m_Focused)
+            invalidate();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
+
+        // Continue wrapping the loaded text in the next frame
+        if (m_LineStartsComplete == false)
+            scheduleUpdate(sf::Time::Zero);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2392,18 +2347,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -2416,28 +2359,28 @@ namespace tgui
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
             border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw right border
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
             border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
 
             // Draw bottom border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
+            TGUI_Renderer.draw(target, border, states);
         }
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
         front.setFillColor(m_BackgroundColor);
-        target.draw(front, states);
+        TGUI_Renderer.draw(target, front, states);
 
         // Set the text on the correct position
         if (m_Scroll != nullptr)
@@ -2448,144 +2391,30 @@ namespace tgui
         // Remeber this tranformation
         sf::Transform oldTransform = states.transform;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+        // Only allow drawing the text inside the text box
+        TGUI_Renderer.pushClipping(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        states.transform.translate(-m_TextShift.x, 0);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
-        sf::Text tempText(m_TextBeforeSelection);
-        tempText.setString("kg");
-        sf::Vector2f textShift(tempText.getLocalBounds().left, tempText.getLocalBounds().top);
-
-        // Draw the text
-        states.transform.translate(-textShift.x, -textShift.y);
-        target.draw(m_TextBeforeSelection, states);
-        states.transform.translate(0, textShift.y);
-
-        // Check if there is a selection
-        if (m_SelChars > 0)
+        // Draw the backgrounds of the selected text
+        if (!m_SelectionRects.empty())
         {
-            // Store the lenghts of the texts
-            unsigned int textBeforeSelectionLength = m_TextBeforeSelection.getString().getSize() + 1;
-            unsigned int textSelection1Length = m_TextSelection1.getString().getSize() + 1;
-            unsigned int textSelection2Length = m_TextSelection2.getString().getSize() + 1;
-
-            // Set the text on the correct position
-            states.transform.translate(m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).y);
-
-            // Watch out for kerning
-            if (textBeforeSelectionLength > 1)
-                states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-            // Create the selection background
-            sf::RectangleShape selectionBackground1(sf::Vector2f(m_TextSelection1.findCharacterPos(textSelection1Length).x, static_cast<float>(m_LineHeight)));
-            selectionBackground1.setFillColor(m_SelectedTextBgrColor);
+            sf::RectangleShape selectionBackground;
+            selectionBackground.setFillColor(m_SelectedTextBgrColor);
 
-            // Draw the selection background
-            target.draw(selectionBackground1, states);
-
-            // Draw the first part of the selected text
-            states.transform.translate(0, -textShift.y);
-            target.draw(m_TextSelection1, states);
-            states.transform.translate(0, textShift.y);
-
-            // Check if there is a second part in the selection
-            if (m_TextSelection2.getString().getSize() > 0)
+            for (auto it = m_SelectionRects.begin(); it != m_SelectionRects.end(); ++it)
             {
-                // Translate to the beginning of the next line
-                states.transform.translate(-m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, static_cast<float>(m_LineHeight));
-
-                // If there was a kerning correction then undo it now
-                if (textBeforeSelectionLength > 1)
-                    states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-                // Create the second selection background
-                sf::RectangleShape selectionBackground2;
-                selectionBackground2.setFillColor(m_SelectedTextBgrColor);
-
-                // Draw the background rectangles of the selected text
-                for (unsigned int i=0; i<m_MultilineSelectionRectWidth.size(); ++i)
-                {
-                    selectionBackground2.setSize(sf::Vector2f(m_MultilineSelectionRectWidth[i], static_cast<float>(m_LineHeight)));
-                    target.draw(selectionBackground2, states);
-                    selectionBackground2.move(0, static_cast<float>(m_LineHeight));
-                }
-
-                // Draw the second part of the selection
-                states.transform.translate(0, -textShift.y);
-                target.draw(m_TextSelection2, states);
-                states.transform.translate(0, textShift.y);
-
-                // Translate to the end of the selection
-                states.transform.translate(m_TextSelection2.findCharacterPos(textSelection2Length));
-
-                // Watch out for kerning
-                if (m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2)
-                    states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2], m_TextSize)), 0);
-            }
-            else // The selection was only on one line
-            {
-                // Translate to the end of the selection
-                states.transform.translate(m_TextSelection1.findCharacterPos(textSelection1Length).x, 0);
-
-                // Watch out for kerning
-                if ((m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length - 2) && (textBeforeSelectionLength + textSelection1Length > 2))
-                    states.transform.translate(static_cast<float>(m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 2], m_TextSize)), 0);
-            }
-
-            // Draw the first part of the text behind the selection
-            states.transform.translate(0, -textShift.y);
-            target.draw(m_TextAfterSelection1, states);
-            states.transform.translate(textShift.x, textShift.y);
-
-            // Check if there is a second part in the selection
-            if (m_TextAfterSelection2.getString().getSize() > 0)
-            {
-                // Translate to the beginning of the next line
-                if (m_TextSelection2.getString().getSize() > 0)
-                {
-                    // Undo the last translation
-                    states.transform.translate(-m_TextSelection2.findCharacterPos(textSelection2Length).x, static_cast<float>(m_LineHeight));
-
-                    // If there was a kerning correction then undo it now
-                    if (m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2)
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length + textSelection2Length - 2], m_TextSize)), 0);
-                }
-                else
-                {
-                    // Undo the last translation
-                    states.transform.translate(-m_TextSelection1.findCharacterPos(textSelection1Length).x - m_TextBeforeSelection.findCharacterPos(textBeforeSelectionLength).x, static_cast<float>(m_LineHeight));
-
-                    // If there was a kerning correction then undo it now
-                    if (textBeforeSelectionLength > 1)
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength-2], m_DisplayedText[textBeforeSelectionLength-1], m_TextSize)), 0);
-
-                    // If there was a kerning correction then undo it now
-                    if ((m_DisplayedText.getSize() > textBeforeSelectionLength + textSelection1Length - 2) && (textBeforeSelectionLength + textSelection1Length > 2))
-                        states.transform.translate(static_cast<float>(-m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 3], m_DisplayedText[textBeforeSelectionLength + textSelection1Length - 2], m_TextSize)), 0);
-                }
-
-                // Draw the second part of the text after the selection
-                states.transform.translate(-textShift.x, -textShift.y);
-                target.draw(m_TextAfterSelection2, states);
-                states.transform.translate(textShift.x, textShift.y);
+                selectionBackground.setPosition(it->left, it->top);
+                selectionBackground.setSize(sf::Vector2f(it->width, it->height));
+                TGUI_Renderer.draw(target, selectionBackground, states);
             }
         }
 
+        // Draw the text of the visible lines
+        states.transform.translate(0, -m_TextShift.y);
+        for (auto it = m_LineTexts.begin(); it != m_LineTexts.end(); ++it)
+            TGUI_Renderer.draw(target, *it, states);
+
         // Only draw the selection point if it has a width
         if (m_SelectionPointWidth > 0)
         {
@@ -2594,7 +2423,7 @@ namespace tgui
             {
                 // Reset the transformation
                 states.transform = oldTransform;
-                states.transform.translate(-textShift.x, 0);
+                states.transform.translate(-m_TextShift.x, 0);
 
                 // Create the selection point rectangle
                 sf::RectangleShape selectionPoint(sf::Vector2f(static_cast<float>(m_SelectionPointWidth), static_cast<float>(m_LineHeight)));
@@ -2602,12 +2431,12 @@ namespace tgui
                 selectionPoint.setFillColor(m_SelectionPointColor);
 
                 // Draw the selection point
-                target.draw(selectionPoint, states);
+                TGUI_Renderer.draw(target, selectionPoint, states);
             }
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        TGUI_Renderer.popClipping();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <TGUI/TextBuffer.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    // The size of the gap when the buffer is first filled, the gap doubles every time it runs full
+    static const std::size_t minimumGapSize = 64;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBuffer::TextBuffer() :
+    m_GapStart(0),
+    m_GapEnd  (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBuffer::TextBuffer(const sf::String& text) :
+    m_GapStart(0),
+    m_GapEnd  (0)
+    {
+        insert(0, text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBuffer& TextBuffer::operator= (const sf::String& text)
+    {
+        clear();
+        insert(0, text);
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBuffer::getSize() const
+    {
+        return m_Buffer.size() - (m_GapEnd - m_GapStart);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBuffer::isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint32 TextBuffer::operator[] (std::size_t index) const
+    {
+        if (index < m_GapStart)
+            return m_Buffer[index];
+        else
+            return m_Buffer[index + (m_GapEnd - m_GapStart)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::insert(std::size_t position, sf::Uint32 character)
+    {
+        moveGap(position, 1);
+
+        m_Buffer[m_GapStart] = character;
+        ++m_GapStart;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::insert(std::size_t position, const sf::String& text)
+    {
+        if (text.isEmpty())
+            return;
+
+        moveGap(position, text.getSize());
+
+        std::copy(text.begin(), text.end(), m_Buffer.begin() + m_GapStart);
+        m_GapStart += text.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::insert(std::size_t position, const sf::Uint32* characters, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        moveGap(position, count);
+
+        std::copy(characters, characters + count, m_Buffer.begin() + m_GapStart);
+        m_GapStart += count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::erase(std::size_t position, std::size_t count)
+    {
+        if (position >= getSize())
+            return;
+
+        if (count > getSize() - position)
+            count = getSize() - position;
+
+        // The removed characters simply become part of the gap
+        moveGap(position, 0);
+        m_GapEnd += count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::clear()
+    {
+        m_GapStart = 0;
+        m_GapEnd = m_Buffer.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBuffer::getString(std::size_t start, std::size_t end) const
+    {
+        if (end > getSize())
+            end = getSize();
+
+        if (start >= end)
+            return "";
+
+        std::basic_string<sf::Uint32> text;
+        text.reserve(end - start);
+
+        // Copy the part in front of the gap and the part behind it
+        if (start < m_GapStart)
+            text.append(m_Buffer.begin() + start, m_Buffer.begin() + std::min(end, m_GapStart));
+
+        if (end > m_GapStart)
+            text.append(m_Buffer.begin() + (std::max(start, m_GapStart) + (m_GapEnd - m_GapStart)), m_Buffer.begin() + (end + (m_GapEnd - m_GapStart)));
+
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBuffer::moveGap(std::size_t position, std::size_t minimumSize)
+    {
+        if (position > getSize())
+            position = getSize();
+
+        // Move the characters between the gap and the new position to the other side of the gap
+        if (position < m_GapStart)
+        {
+            std::copy_backward(m_Buffer.begin() + position, m_Buffer.begin() + m_GapStart, m_Buffer.begin() + m_GapEnd);
+            m_GapEnd -= m_GapStart - position;
+            m_GapStart = position;
+        }
+        else if (position > m_GapStart)
+        {
+            std::copy(m_Buffer.begin() + m_GapEnd, m_Buffer.begin() + m_GapEnd + (position - m_GapStart), m_Buffer.begin() + m_GapStart);
+            m_GapEnd += position - m_GapStart;
+            m_GapStart = position;
+        }
+
+        // Make the buffer larger when the gap is too small
+        if (m_GapEnd - m_GapStart < minimumSize)
+        {
+            const std::size_t gapSize = std::max(std::max(minimumSize, getSize()), minimumGapSize);
+            const std::size_t charactersBehindGap = m_Buffer.size() - m_GapEnd;
+
+            std::vector<sf::Uint32> buffer(m_GapStart + gapSize + charactersBehindGap);
+            std::copy(m_Buffer.begin(), m_Buffer.begin() + m_GapStart, buffer.begin());
+            std::copy(m_Buffer.begin() + m_GapEnd, m_Buffer.end(), buffer.begin() + m_GapStart + gapSize);
+
+            m_Buffer.swap(buffer);
+            m_GapEnd = m_GapStart + gapSize;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
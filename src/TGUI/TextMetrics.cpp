@@ -0,0 +1,235 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <algorithm>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMetrics::Table::Table()
+    {
+        std::fill(latinAdvances, latinAdvances + 256, -1.0f);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMetrics::TextMetrics() :
+    m_LastFont         (nullptr),
+    m_LastCharacterSize(0),
+    m_LastTable        (nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getAdvance(const sf::Font& font, unsigned int characterSize, sf::Uint32 character)
+    {
+        return getAdvance(getTable(font, characterSize), font, characterSize, character);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getKerning(const sf::Font& font, unsigned int characterSize, sf::Uint32 first, sf::Uint32 second)
+    {
+        return getKerning(getTable(font, characterSize), font, characterSize, first, second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getTextWidth(const sf::Font& font, unsigned int characterSize, const sf::String& text, std::size_t start, std::size_t end)
+    {
+        Table& table = getTable(font, characterSize);
+
+        if (end > text.getSize())
+            end = text.getSize();
+
+        float width = 0;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (i > start)
+                width += getKerning(table, font, characterSize, text[i-1], text[i]);
+
+            if (text[i] == '\n')
+                width = 0;
+            else
+                width += getAdvance(table, font, characterSize, text[i]);
+        }
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMetrics::getCharacterPositions(const sf::Font& font, unsigned int characterSize, const sf::String& text, std::vector<float>& positions,
+                                            std::size_t start, std::size_t end)
+    {
+        Table& table = getTable(font, characterSize);
+
+        if (end > text.getSize())
+            end = text.getSize();
+
+        positions.clear();
+        positions.reserve((end > start) ? end - start + 1 : 1);
+        positions.push_back(0);
+
+        float width = 0;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (i > start)
+                width += getKerning(table, font, characterSize, text[i-1], text[i]);
+
+            if (text[i] == '\n')
+                width = 0;
+            else
+                width += getAdvance(table, font, characterSize, text[i]);
+
+            positions.push_back(width);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextMetrics::findCharacterIndex(const sf::Font& font, unsigned int characterSize, const sf::String& text, float x,
+                                                std::size_t start, std::size_t end)
+    {
+        Table& table = getTable(font, characterSize);
+
+        if (end > text.getSize())
+            end = text.getSize();
+
+        float width = 0;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            float charWidth = getAdvance(table, font, characterSize, text[i]);
+            if (i > start)
+                charWidth += getKerning(table, font, characterSize, text[i-1], text[i]);
+
+            // Check if the position lies on the first half of the character
+            if (x < width + (charWidth / 2.f))
+                return i;
+
+            width += charWidth;
+        }
+
+        return (end > start) ? end : start;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMetrics::removeFont(const sf::Font& font)
+    {
+        auto it = m_Tables.lower_bound(std::make_pair(&font, 0u));
+        while ((it != m_Tables.end()) && (it->first.first == &font))
+            it = m_Tables.erase(it);
+
+        if (m_LastFont == &font)
+        {
+            m_LastFont = nullptr;
+            m_LastTable = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMetrics::clear()
+    {
+        m_Tables.clear();
+
+        m_LastFont = nullptr;
+        m_LastTable = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMetrics::Table& TextMetrics::getTable(const sf::Font& font, unsigned int characterSize)
+    {
+        if ((m_LastTable == nullptr) || (m_LastFont != &font) || (m_LastCharacterSize != characterSize))
+        {
+            m_LastFont = &font;
+            m_LastCharacterSize = characterSize;
+            m_LastTable = &m_Tables[std::make_pair(&font, characterSize)];
+        }
+
+        return *m_LastTable;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getAdvance(Table& table, const sf::Font& font, unsigned int characterSize, sf::Uint32 character)
+    {
+        if ((character < 256) && (table.latinAdvances[character] >= 0))
+            return table.latinAdvances[character];
+
+        float advance;
+        if (character >= 256)
+        {
+            auto it = table.advances.find(character);
+            if (it != table.advances.end())
+                return it->second;
+
+            advance = static_cast<float>(font.getGlyph(character, characterSize, false).advance);
+            table.advances[character] = advance;
+        }
+        else
+        {
+            // Tabs are four spaces wide and newlines have no width, just like in sf::Text
+            if (character == '\t')
+                advance = 4 * static_cast<float>(font.getGlyph(' ', characterSize, false).advance);
+            else if (character == '\n')
+                advance = 0;
+            else
+                advance = static_cast<float>(font.getGlyph(character, characterSize, false).advance);
+
+            table.latinAdvances[character] = advance;
+        }
+
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getKerning(Table& table, const sf::Font& font, unsigned int characterSize, sf::Uint32 first, sf::Uint32 second)
+    {
+        const sf::Uint64 key = (static_cast<sf::Uint64>(first) << 32) | second;
+
+        auto it = table.kerning.find(key);
+        if (it != table.kerning.end())
+            return it->second;
+
+        float kerning = static_cast<float>(font.getKerning(first, second, characterSize));
+        table.kerning[key] = kerning;
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Texture::Texture() :
-    data(nullptr)
+    data    (nullptr),
+    repeated(false)
     {
     }
 
@@ -41,7 +42,12 @@ namespace tgui
     sf::Vector2u Texture::getSize() const
     {
         if (data != nullptr)
-            return data->texture.getSize();
+        {
+            if (data->page != nullptr)
+                return sf::Vector2u(data->atlasRect.width, data->atlasRect.height);
+            else
+                return data->texture.getSize();
+        }
         else
             return sf::Vector2u(0, 0);
     }
@@ -58,6 +64,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::setTextureRect(const sf::IntRect& rect)
+    {
+        if (isInAtlas())
+            sprite.setTextureRect(sf::IntRect(rect.left + data->atlasRect.left, rect.top + data->atlasRect.top, rect.width, rect.height));
+        else
+            sprite.setTextureRect(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect Texture::getTextureRect() const
+    {
+        sf::IntRect rect = sprite.getTextureRect();
+
+        if (isInAtlas())
+        {
+            rect.left -= data->atlasRect.left;
+            rect.top -= data->atlasRect.top;
+        }
+
+        return rect;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setRepeated(bool repeat)
+    {
+        if (data == nullptr)
+            return;
+
+        // Repeating the atlas page would show the other images, so the renderer takes care of the repeating instead
+        repeated = repeat;
+
+        if (!isInAtlas())
+            data->texture.setRepeated(repeat);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setSmooth(bool smooth)
+    {
+        if (data == nullptr)
+            return;
+
+        // Smoothing would blend the borders with the neighbouring images in the atlas page
+        if (smooth)
+            detachFromAtlas();
+
+        if (!isInAtlas())
+            data->texture.setSmooth(smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isSmooth() const
+    {
+        if ((data != nullptr) && !isInAtlas())
+            return data->texture.isSmooth();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isInAtlas() const
+    {
+        return (data != nullptr) && (data->page != nullptr) && (sprite.getTexture() == &data->page->texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::detachFromAtlas()
+    {
+        if (!isInAtlas())
+            return;
+
+        // The own texture is only created when the first user needs it
+        if (data->texture.getSize().x == 0)
+        {
+            bool success;
+            if (data->rect == sf::IntRect(0, 0, 0, 0))
+                success = data->texture.loadFromImage(*data->image);
+            else
+                success = data->texture.loadFromImage(*data->image, data->rect);
+
+            if (!success)
+            {
+                TGUI_OUTPUT("TGUI warning: Failed to move texture out of the atlas.");
+                return;
+            }
+        }
+
+        // Keep showing the same part of the image
+        sf::IntRect rect = getTextureRect();
+        sprite.setTexture(data->texture);
+        sprite.setTextureRect(rect);
+
+        if (repeated)
+            data->texture.setRepeated(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Texture::operator const sf::Sprite&() const
     {
         return sprite;
@@ -66,6 +175,14 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TextureManager::TextureManager() :
+    m_AtlasEnabled (false),
+    m_AtlasPageSize(1024)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect)
     {
         // Look if we already had this image
@@ -85,7 +202,13 @@ namespace tgui
                     texture.data = &(*it);
 
                     // Set the texture in the sprite
-                    texture.sprite.setTexture(it->texture, true);
+                    if (it->page != nullptr)
+                    {
+                        texture.sprite.setTexture(it->page->texture);
+                        texture.sprite.setTextureRect(it->atlasRect);
+                    }
+                    else
+                        texture.sprite.setTexture(it->texture, true);
 
                     return true;
                 }
@@ -106,18 +229,49 @@ namespace tgui
         // load the image
         if (texture.data->image->loadFromFile(filename))
         {
-            // Create a texture from the image
-            bool success;
-            if (rect == sf::IntRect(0, 0, 0, 0))
-                success = texture.data->texture.loadFromImage(*texture.data->image);
-            else
-                success = texture.data->texture.loadFromImage(*texture.data->image, rect);
+            // The whole image is packed in the atlas when it is loaded for the first time
+            if (m_AtlasEnabled && (imageIt->second.data.size() == 1))
+            {
+                if (!addToAtlas(imageIt->second.image, imageIt->second.page, imageIt->second.atlasPosition))
+                    imageIt->second.page = nullptr;
+            }
 
-            if (success)
+            bool success;
+            if (imageIt->second.page != nullptr)
+            {
+                // Find the part of the atlas page that contains the requested part of the image
+                sf::IntRect imageRect(0, 0, texture.data->image->getSize().x, texture.data->image->getSize().y);
+                if (rect == sf::IntRect(0, 0, 0, 0))
+                    success = true;
+                else
+                    success = imageRect.intersects(rect, imageRect);
+
+                if (success)
+                {
+                    texture.data->page = imageIt->second.page;
+                    texture.data->atlasRect = sf::IntRect(imageIt->second.atlasPosition.x + imageRect.left,
+                                                          imageIt->second.atlasPosition.y + imageRect.top,
+                                                          imageRect.width,
+                                                          imageRect.height);
+
+                    texture.sprite.setTexture(texture.data->page->texture);
+                    texture.sprite.setTextureRect(texture.data->atlasRect);
+                }
+            }
+            else // Create a texture from the image
             {
+                if (rect == sf::IntRect(0, 0, 0, 0))
+                    success = texture.data->texture.loadFromImage(*texture.data->image);
+                else
+                    success = texture.data->texture.loadFromImage(*texture.data->image, rect);
+
                 // Set the texture in the sprite
-                texture.sprite.setTexture(texture.data->texture, true);
+                if (success)
+                    texture.sprite.setTexture(texture.data->texture, true);
+            }
 
+            if (success)
+            {
                 // Set the other members of the data
                 texture.data->filename = filename;
                 texture.data->users = 1;
@@ -125,8 +279,12 @@ namespace tgui
             }
         }
 
-        // The image couldn't be loaded
-        m_ImageMap.erase(imageIt);
+        // The image couldn't be loaded, remove it unless other parts of the image are still being used
+        if (imageIt->second.data.size() == 1)
+            removeImage(imageIt);
+        else
+            imageIt->second.data.pop_back();
+
         texture.data = nullptr;
         return false;
     }
@@ -180,7 +338,7 @@ namespace tgui
                         // Remove the texture from the list, or even the whole image if it isn't used anywhere else
                         int usage = std::count_if(imageIt->second.data.begin(), imageIt->second.data.end(), [dataIt](TextureData& data){ return data.image == dataIt->image; });
                         if (usage == 1)
-                            m_ImageMap.erase(imageIt);
+                            removeImage(imageIt);
                         else
                             imageIt->second.data.erase(dataIt);
                     }
@@ -198,6 +356,173 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextureManager::enableAtlas(unsigned int pageSize)
+    {
+        m_AtlasEnabled = true;
+        m_AtlasPageSize = pageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::disableAtlas()
+    {
+        m_AtlasEnabled = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageCount() const
+    {
+        return m_AtlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(const sf::Image& image, AtlasPage*& page, sf::Vector2i& position)
+    {
+        // Leave one transparent pixel between the images so that they don't bleed into each other when scaled
+        unsigned int width = image.getSize().x + 1;
+        unsigned int height = image.getSize().y + 1;
+
+        unsigned int pageSize = std::min(m_AtlasPageSize, sf::Texture::getMaximumSize());
+        if ((width > pageSize) || (height > pageSize))
+            return false;
+
+        // Find the page in which the image can be placed the lowest
+        AtlasPage* bestPage = nullptr;
+        int bestIndex = -1;
+        int bestY = 0;
+        for (auto it = m_AtlasPages.begin(); it != m_AtlasPages.end(); ++it)
+        {
+            int y;
+            int index = findSkylinePosition(*it, width, height, y);
+            if ((index >= 0) && ((bestPage == nullptr) || (y < bestY)))
+            {
+                bestPage = &(*it);
+                bestIndex = index;
+                bestY = y;
+            }
+        }
+
+        // Create a new page when the image doesn't fit in any of the existing ones
+        if (bestPage == nullptr)
+        {
+            sf::Image emptyImage;
+            emptyImage.create(pageSize, pageSize, sf::Color::Transparent);
+
+            m_AtlasPages.push_back(AtlasPage());
+            if (!m_AtlasPages.back().texture.loadFromImage(emptyImage))
+            {
+                m_AtlasPages.pop_back();
+                return false;
+            }
+
+            m_AtlasPages.back().skyline.push_back(sf::Vector3i(0, 0, pageSize));
+            m_AtlasPages.back().images = 0;
+
+            bestPage = &m_AtlasPages.back();
+            bestIndex = 0;
+            bestY = 0;
+        }
+
+        std::vector<sf::Vector3i>& skyline = bestPage->skyline;
+        position = sf::Vector2i(skyline[bestIndex].x, bestY);
+
+        // The image now lies on top of the skyline, shrink or remove the segments that are now covered
+        skyline.insert(skyline.begin() + bestIndex, sf::Vector3i(position.x, position.y + height, width));
+        for (unsigned int i = bestIndex + 1; i < skyline.size();)
+        {
+            int overlap = skyline[i-1].x + skyline[i-1].z - skyline[i].x;
+            if (overlap <= 0)
+                break;
+
+            skyline[i].x += overlap;
+            skyline[i].z -= overlap;
+
+            if (skyline[i].z <= 0)
+                skyline.erase(skyline.begin() + i);
+            else
+                break;
+        }
+
+        // Merge the neighbouring segments that have the same height
+        for (unsigned int i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i+1].y)
+            {
+                skyline[i].z += skyline[i+1].z;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+                ++i;
+        }
+
+        bestPage->texture.update(image, position.x, position.y);
+        ++(bestPage->images);
+
+        page = bestPage;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int TextureManager::findSkylinePosition(const AtlasPage& page, unsigned int width, unsigned int height, int& y) const
+    {
+        const std::vector<sf::Vector3i>& skyline = page.skyline;
+        const int pageSize = static_cast<int>(page.texture.getSize().x);
+
+        int bestIndex = -1;
+        for (unsigned int i = 0; i < skyline.size(); ++i)
+        {
+            if (skyline[i].x + static_cast<int>(width) > pageSize)
+                break;
+
+            // The image has to be placed above all the segments that it covers
+            int top = 0;
+            int widthLeft = width;
+            for (unsigned int j = i; (j < skyline.size()) && (widthLeft > 0); ++j)
+            {
+                top = std::max(top, skyline[j].y);
+                widthLeft -= skyline[j].z;
+            }
+
+            if (top + static_cast<int>(height) > pageSize)
+                continue;
+
+            if ((bestIndex == -1) || (top < y))
+            {
+                bestIndex = i;
+                y = top;
+            }
+        }
+
+        return bestIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeImage(std::map<std::string, ImageMapData>::iterator imageIt)
+    {
+        // Release the place in the atlas page and remove the page when no other images are using it.
+        // The space of the image itself can't be reused, the skyline only grows.
+        AtlasPage* page = imageIt->second.page;
+        if ((page != nullptr) && (--(page->images) == 0))
+        {
+            for (auto pageIt = m_AtlasPages.begin(); pageIt != m_AtlasPages.end(); ++pageIt)
+            {
+                if (&(*pageIt) == page)
+                {
+                    m_AtlasPages.erase(pageIt);
+                    break;
+                }
+            }
+        }
+
+        m_ImageMap.erase(imageIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
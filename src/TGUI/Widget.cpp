@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/WidgetArena.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Container.hpp>
 
@@ -34,19 +35,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Widget() :
-    m_Enabled        (true),
-    m_Visible        (true),
-    m_Loaded         (false),
-    m_WidgetPhase    (0),
-    m_Parent         (nullptr),
-    m_Opacity        (255),
-    m_MouseHover     (false),
-    m_MouseDown      (false),
-    m_Focused        (false),
-    m_AllowFocus     (false),
-    m_AnimatedWidget (false),
-    m_DraggableWidget(false),
-    m_ContainerWidget(false)
+    m_Enabled                    (true),
+    m_Visible                    (true),
+    m_Loaded                     (false),
+    m_WidgetPhase                (0),
+    m_Parent                     (nullptr),
+    m_AbsolutePositionNeedsUpdate(true),
+    m_Opacity                    (255),
+    m_MouseHover                 (false),
+    m_MouseDown                  (false),
+    m_Focused                    (false),
+    m_AllowFocus                 (false),
+    m_AnimatedWidget             (false),
+    m_UpdateScheduled            (false),
+    m_UpdateScheduler            (nullptr),
+    m_CoalescedCallbackScheduler (nullptr),
+    m_DraggableWidget            (false),
+    m_ContainerWidget            (false),
+    m_RefCount                   (0)
     {
         m_Callback.widget = nullptr;
         m_Callback.widgetType = Type_Unknown;
@@ -56,24 +62,33 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Widget(const Widget& copy) :
-    sf::Drawable     (copy),
-    Transformable    (copy),
-    CallbackManager  (copy),
-    m_Enabled        (copy.m_Enabled),
-    m_Visible        (copy.m_Visible),
-    m_Loaded         (copy.m_Loaded),
-    m_WidgetPhase    (copy.m_WidgetPhase),
-    m_Parent         (copy.m_Parent),
-    m_Opacity        (copy.m_Opacity),
-    m_MouseHover     (false),
-    m_MouseDown      (false),
-    m_Focused        (false),
-    m_AllowFocus     (copy.m_AllowFocus),
-    m_AnimatedWidget (copy.m_AnimatedWidget),
-    m_DraggableWidget(copy.m_DraggableWidget),
-    m_ContainerWidget(copy.m_ContainerWidget)
+    sf::Drawable                 (copy),
+    Transformable                (copy),
+    CallbackManager              (copy),
+    m_Enabled                    (copy.m_Enabled),
+    m_Visible                    (copy.m_Visible),
+    m_Loaded                     (copy.m_Loaded),
+    m_WidgetPhase                (copy.m_WidgetPhase),
+    m_Parent                     (copy.m_Parent),
+    m_AbsolutePositionNeedsUpdate(true),
+    m_Opacity                    (copy.m_Opacity),
+    m_MouseHover                 (false),
+    m_MouseDown                  (false),
+    m_Focused                    (false),
+    m_AllowFocus                 (copy.m_AllowFocus),
+    m_AnimatedWidget             (copy.m_AnimatedWidget),
+    m_UpdateScheduled            (copy.m_UpdateScheduled),
+    m_UpdateDelay                (copy.m_UpdateDelay),
+    m_UpdateScheduler            (nullptr),
+    m_CoalescedCallbackScheduler (nullptr),
+    m_DraggableWidget            (copy.m_DraggableWidget),
+    m_ContainerWidget            (copy.m_ContainerWidget),
+    m_RefCount                   (0)
     {
         m_Callback.widget = nullptr;
+
+        // The callbacks that the other widget was holding back don't belong to the copy
+        m_CoalescedCallbacks.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +99,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void* Widget::operator new(std::size_t size)
+    {
+        return allocateWidget(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::operator delete(void* widget, std::size_t size)
+    {
+        deallocateWidget(widget, size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget& Widget::operator= (const Widget& right)
     {
         // Make sure it is not the same widget
@@ -98,6 +127,7 @@ namespace tgui
             m_Loaded              = right.m_Loaded;
             m_WidgetPhase         = right.m_WidgetPhase;
             m_Parent              = right.m_Parent;
+            m_AbsolutePositionNeedsUpdate = true;
             m_Opacity             = right.m_Opacity;
             m_MouseHover          = false;
             m_MouseDown           = false;
@@ -110,6 +140,7 @@ namespace tgui
             m_Callback.widget     = nullptr;
             m_Callback.widgetType = right.m_Callback.widgetType;
             m_Callback.id         = right.m_Callback.id;
+            m_CoalescedCallbacks.clear();
         }
 
         return *this;
@@ -117,12 +148,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setPosition(float x, float y)
+    {
+        Transformable::setPosition(x, y);
+        absolutePositionChanged();
+        invalidateBounds();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f Widget::getAbsolutePosition() const
     {
-        if (m_Parent)
-            return m_Parent->getAbsolutePosition() + m_Parent->getWidgetsOffset() + getPosition();
-        else
-            return getPosition();
+        if (m_AbsolutePositionNeedsUpdate)
+        {
+            if (m_Parent)
+                m_AbsolutePosition = m_Parent->getAbsolutePosition() + m_Parent->getWidgetsOffset() + getPosition();
+            else
+                m_AbsolutePosition = getPosition();
+
+            m_AbsolutePositionNeedsUpdate = false;
+        }
+
+        return m_AbsolutePosition;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect Widget::getBounds() const
+    {
+        return sf::FloatRect(getPosition().x, getPosition().y, getFullSize().x, getFullSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +184,7 @@ namespace tgui
     void Widget::show()
     {
         m_Visible = true;
+        invalidateBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +192,7 @@ namespace tgui
     void Widget::hide()
     {
         m_Visible = false;
+        invalidateBounds();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -154,6 +210,7 @@ namespace tgui
     void Widget::enable()
     {
         m_Enabled = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +222,7 @@ namespace tgui
         // Change the mouse button state.
         m_MouseHover = false;
         m_MouseDown = false;
+        invalidate();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -203,7 +261,7 @@ namespace tgui
 
     void Widget::unfocus()
     {
-        if (m_Focused)
+        if (m_Focused && m_Parent)
             m_Parent->unfocusWidgets();
     }
 
@@ -233,6 +291,7 @@ namespace tgui
     void Widget::setTransparency(unsigned char transparency)
     {
         m_Opacity = transparency;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,14 +305,16 @@ namespace tgui
 
     void Widget::moveToFront()
     {
-        m_Parent->moveWidgetToFront(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToFront(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::moveToBack()
     {
-        m_Parent->moveWidgetToBack(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToBack(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,25 +339,106 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::scheduleUpdate(const sf::Time& delay)
+    {
+        m_UpdateScheduled = true;
+        m_UpdateDelay = delay;
+
+        // The gui will be found through the parents, if the widget was already added to one
+        if (m_Parent)
+            m_Parent->scheduleChildUpdate(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        // The change has to reach the gui, which is the only container without a parent
+        if (m_Parent)
+            m_Parent->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateBounds()
+    {
+        invalidate();
+
+        if (m_Parent)
+            m_Parent->widgetChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::addCallback()
+    {
+        // Nothing has to be done when nothing is bound to the trigger
+        if (!isCallbackBound(m_Callback.trigger))
+            return;
+
+        // Coalesced callbacks are held back until the gui sends them, only the last one of every trigger is kept
+        if ((m_CoalescedTriggers & m_Callback.trigger) && m_Parent)
+        {
+            auto it = m_CoalescedCallbacks.begin();
+            while ((it != m_CoalescedCallbacks.end()) && (it->trigger != m_Callback.trigger))
+                ++it;
+
+            if (it != m_CoalescedCallbacks.end())
+                *it = m_Callback;
+            else
+                m_CoalescedCallbacks.push_back(m_Callback);
+
+            if (m_CoalescedCallbackScheduler == nullptr)
+                m_Parent->scheduleChildCallbacks(this);
+
+            return;
+        }
+
+        sendCallback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::sendCallback()
     {
         // Loop through all callback functions
-        auto& functions = m_CallbackFunctions[m_Callback.trigger];
+        auto& functions = getCallbackFunctions(m_Callback.trigger);
         for (auto func = functions.cbegin(); func != functions.cend(); ++func)
         {
             // Pass the callback to the correct place
             if (*func != nullptr)
                 (*func)();
-            else
+            else if (m_Parent)
                 m_Parent->addChildCallback(m_Callback);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::sendCoalescedCallbacks()
+    {
+        // The callback functions may cause new callbacks, these will be sent during the next frame
+        std::vector<Callback> callbacks;
+        callbacks.swap(m_CoalescedCallbacks);
+
+        for (auto it = callbacks.cbegin(); it != callbacks.cend(); ++it)
+        {
+            // The functions may have been unbound in the meantime
+            if (!isCallbackBound(it->trigger))
+                continue;
+
+            m_Callback = *it;
+            sendCallback();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::mouseEnteredWidget()
     {
-        if (m_CallbackFunctions[MouseEntered].empty() == false)
+        invalidate();
+
+        if (isCallbackBound(MouseEntered))
         {
             m_Callback.trigger = MouseEntered;
             addCallback();
@@ -307,7 +449,9 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
-        if (m_CallbackFunctions[MouseLeft].empty() == false)
+        invalidate();
+
+        if (isCallbackBound(MouseLeft))
         {
             m_Callback.trigger = MouseLeft;
             addCallback();
@@ -358,7 +502,9 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
-        if (m_CallbackFunctions[Focused].empty() == false)
+        invalidate();
+
+        if (isCallbackBound(Focused))
         {
             m_Callback.trigger = Focused;
             addCallback();
@@ -373,7 +519,9 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
-        if (m_CallbackFunctions[Unfocused].empty() == false)
+        invalidate();
+
+        if (isCallbackBound(Unfocused))
         {
             m_Callback.trigger = Unfocused;
             addCallback();
@@ -394,6 +542,9 @@ namespace tgui
 
     void Widget::mouseNoLongerDown()
     {
+        if (m_MouseDown)
+            invalidate();
+
         m_MouseDown = false;
     }
 
@@ -506,13 +657,13 @@ namespace tgui
         {
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(Focused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Focused).size() == 1) && (m_CallbackFunctions.at(Focused).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Focused))
                 callbacks.push_back("Focused");
-            if ((m_CallbackFunctions.find(Unfocused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unfocused).size() == 1) && (m_CallbackFunctions.at(Unfocused).front() == nullptr))
+            if (isCallbackBoundToParentOnly(Unfocused))
                 callbacks.push_back("Unfocused");
-            if ((m_CallbackFunctions.find(MouseEntered) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseEntered).size() == 1) && (m_CallbackFunctions.at(MouseEntered).front() == nullptr))
+            if (isCallbackBoundToParentOnly(MouseEntered))
                 callbacks.push_back("MouseEntered");
-            if ((m_CallbackFunctions.find(MouseLeft) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseLeft).size() == 1) && (m_CallbackFunctions.at(MouseLeft).front() == nullptr))
+            if (isCallbackBoundToParentOnly(MouseLeft))
                 callbacks.push_back("MouseLeft");
 
             encodeList(callbacks, value);
@@ -549,6 +700,13 @@ namespace tgui
         m_Parent = parent;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::absolutePositionChanged()
+    {
+        m_AbsolutePositionNeedsUpdate = true;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
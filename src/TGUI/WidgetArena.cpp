@@ -0,0 +1,261 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2014 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <mutex>
+#include <vector>
+#include <atomic>
+
+#include <TGUI/WidgetArena.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Every allocation starts with a header that stores the memory of the arena that the widget came from (nullptr for pools).
+    // The header is as large as the alignment that the system allocator guarantees, so the widget stays aligned.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static const std::size_t widgetHeaderSize = 16;
+
+    // Widgets larger than this are allocated directly from the system
+    static const std::size_t maxPooledSize = 4096;
+
+    // The amount of widgets for which memory is allocated at once when a pool runs empty
+    static const std::size_t widgetsPerSlab = 16;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct WidgetArena::Memory
+    {
+        Memory(std::size_t size) :
+            blockSize (size),
+            blockUsed (0),
+            references(1)
+        {
+        }
+
+        // The blocks in which the widgets are placed behind each other, only the last one still has room for new widgets
+        std::vector<char*> blocks;
+        std::size_t        blockSize;
+        std::size_t        blockUsed;
+
+        // Widgets that are larger than a block get memory of their own
+        std::vector<char*> largeBlocks;
+
+        // The amount of living widgets, plus one as long as the arena exists.
+        // Widgets may be destroyed on another thread when the reference count is thread safe.
+        std::atomic<std::size_t> references;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // A list of free memory slots for every allocation size (in steps of the header size). The slots are cut from slabs which
+    // are kept for the lifetime of the program, so that they can be reused by the next widget of the same size.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct WidgetPool
+    {
+        WidgetPool() :
+            freeLists(maxPooledSize / widgetHeaderSize + 1, nullptr)
+        {
+        }
+
+        std::mutex         mutex;
+        std::vector<void*> freeLists;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static WidgetPool& getWidgetPool()
+    {
+        // The pool is never destroyed, widgets that are destroyed after the end of main may still need it
+        static WidgetPool* pool = new WidgetPool;
+        return *pool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static thread_local WidgetArena* activeArena = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::Scope::Scope(WidgetArena& arena) :
+    m_PreviousArena(activeArena)
+    {
+        activeArena = &arena;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::Scope::~Scope()
+    {
+        activeArena = m_PreviousArena;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::WidgetArena(std::size_t blockSize) :
+    m_Memory(new Memory(blockSize))
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::~WidgetArena()
+    {
+        // Widgets that still exist keep the memory alive until the last of them is destroyed
+        deallocate(m_Memory);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WidgetArena::getWidgetCount() const
+    {
+        return m_Memory->references - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* WidgetArena::allocate(std::size_t size)
+    {
+        ++m_Memory->references;
+
+        // Large widgets get a block of their own, the current block can still be used for the next widgets
+        if (size > m_Memory->blockSize)
+        {
+            char* block = static_cast<char*>(::operator new(size));
+            m_Memory->largeBlocks.push_back(block);
+            return block;
+        }
+
+        // Start a new block when the widget doesn't fit in the current one
+        if (m_Memory->blocks.empty() || (m_Memory->blockUsed + size > m_Memory->blockSize))
+        {
+            m_Memory->blocks.push_back(static_cast<char*>(::operator new(m_Memory->blockSize)));
+            m_Memory->blockUsed = 0;
+        }
+
+        char* memory = m_Memory->blocks.back() + m_Memory->blockUsed;
+        m_Memory->blockUsed += size;
+        return memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::Memory* WidgetArena::getMemory() const
+    {
+        return m_Memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::deallocate(Memory* memory)
+    {
+        // Only the last owner of the memory releases it
+        if (--memory->references > 0)
+            return;
+
+        for (auto it = memory->blocks.begin(); it != memory->blocks.end(); ++it)
+            ::operator delete(*it);
+
+        for (auto it = memory->largeBlocks.begin(); it != memory->largeBlocks.end(); ++it)
+            ::operator delete(*it);
+
+        delete memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena* WidgetArena::getActiveArena()
+    {
+        return activeArena;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* allocateWidget(std::size_t size)
+    {
+        const std::size_t allocationSize = widgetHeaderSize + (size + widgetHeaderSize - 1) / widgetHeaderSize * widgetHeaderSize;
+
+        WidgetArena* arena = WidgetArena::getActiveArena();
+
+        char* memory;
+        if (arena)
+            memory = static_cast<char*>(arena->allocate(allocationSize));
+        else if (allocationSize > maxPooledSize)
+            memory = static_cast<char*>(::operator new(allocationSize));
+        else
+        {
+            WidgetPool& pool = getWidgetPool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            // Cut a new slab into free slots when there are no free slots of this size left
+            void*& freeList = pool.freeLists[allocationSize / widgetHeaderSize];
+            if (freeList == nullptr)
+            {
+                char* slab = static_cast<char*>(::operator new(allocationSize * widgetsPerSlab));
+                for (std::size_t i = 0; i < widgetsPerSlab; ++i)
+                {
+                    void* slot = slab + (i * allocationSize);
+                    *static_cast<void**>(slot) = freeList;
+                    freeList = slot;
+                }
+            }
+
+            memory = static_cast<char*>(freeList);
+            freeList = *static_cast<void**>(freeList);
+        }
+
+        *reinterpret_cast<WidgetArena::Memory**>(memory) = arena ? arena->getMemory() : nullptr;
+        return memory + widgetHeaderSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void deallocateWidget(void* widget, std::size_t size)
+    {
+        const std::size_t allocationSize = widgetHeaderSize + (size + widgetHeaderSize - 1) / widgetHeaderSize * widgetHeaderSize;
+
+        char* memory = static_cast<char*>(widget) - widgetHeaderSize;
+        WidgetArena::Memory* arenaMemory = *reinterpret_cast<WidgetArena::Memory**>(memory);
+
+        if (arenaMemory)
+            WidgetArena::deallocate(arenaMemory);
+        else if (allocationSize > maxPooledSize)
+            ::operator delete(memory);
+        else
+        {
+            WidgetPool& pool = getWidgetPool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            void*& freeList = pool.freeLists[allocationSize / widgetHeaderSize];
+            *reinterpret_cast<void**>(memory) = freeList;
+            freeList = memory;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////